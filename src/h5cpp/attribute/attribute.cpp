@@ -26,6 +26,7 @@
 // Created on: Oct 4, 2017
 //
 #include <h5cpp/attribute/attribute.hpp>
+#include <h5cpp/attribute/attribute_cache.hpp>
 #include <h5cpp/core/utilities.hpp>
 #include <h5cpp/node/link.hpp>
 #include <h5cpp/contrib/stl/string.hpp>
@@ -121,6 +122,11 @@ void Attribute::check_size(const dataspace::Dataspace &mem_space,
   }
 }
 
+void Attribute::invalidate_cache() const
+{
+  AttributeCache::instance().invalidate(*this);
+}
+
 void Attribute::close()
 {
   handle_.close();
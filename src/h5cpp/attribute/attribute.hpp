@@ -206,6 +206,11 @@ class DLL_EXPORT Attribute
     ObjectHandle handle_;
     node::Link   parent_link_;
 
+    //!
+    //! \brief drop the cached values of the parent node
+    //!
+    void invalidate_cache() const;
+
     template<typename T>
     void read(T &data,const datatype::Datatype &mem_type, const datatype::Datatype &file_type) const;
 
@@ -269,7 +274,7 @@ class DLL_EXPORT Attribute
         error::Singleton::instance().throw_with_stack("Failure to read data from attribute!");
       }
 
-      data = Trait::from_buffer(buffer,mem_type,SpaceTrait::create(data));
+      Trait::from_buffer(buffer,mem_type,SpaceTrait::create(data),data);
 
     }
 
@@ -345,6 +350,7 @@ void Attribute::write(const T &data,const datatype::Datatype &mem_type) const
   {
     write_contiguous_data(data,mem_type);
   }
+  invalidate_cache();
 }
 
 template<typename T>
@@ -0,0 +1,244 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+
+#include <mutex>
+#include <stdexcept>
+#include <h5cpp/attribute/attribute.hpp>
+#include <h5cpp/attribute/attribute_cache.hpp>
+#include <h5cpp/error/error.hpp>
+#include <h5cpp/node/group.hpp>
+#include <h5cpp/node/scan.hpp>
+
+namespace hdf5 {
+namespace attribute {
+
+namespace {
+
+//
+// address of an object, for an attribute the address of the object the
+// attribute is attached to
+//
+haddr_t object_address(hid_t object)
+{
+  H5O_info_t_ info;
+#if H5_VERSION_LE(1,10,2)
+  herr_t status = H5Oget_info(object,&info);
+#else
+  herr_t status = H5Oget_info2(object,&info,H5O_INFO_BASIC);
+#endif
+  if(status<0)
+  {
+    error::Singleton::instance().throw_with_stack(
+        "Failure retrieving the address of an object!");
+  }
+  return info.addr;
+}
+
+void throw_not_enabled(const node::Node &node)
+{
+  std::stringstream ss;
+  ss<<"The attribute cache is not enabled for the file of node ["
+    <<node.link().path()<<"]!";
+  throw std::runtime_error(ss.str());
+}
+
+} // anonymous namespace
+
+AttributeCache &AttributeCache::instance()
+{
+  static AttributeCache cache;
+  return cache;
+}
+
+AttributeCache::AttributeCache():
+    mutex_(),
+    files_(),
+    active_(false),
+    hits_(0),
+    misses_(0)
+{}
+
+void AttributeCache::enable(const file::File &file)
+{
+  if(!file.is_valid())
+    throw std::runtime_error("Cannot enable the attribute cache for an invalid file!");
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  files_.emplace(static_cast<hid_t>(file),FileEntry{file,{}});
+  active_ = true;
+}
+
+void AttributeCache::disable(const file::File &file)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  files_.erase(static_cast<hid_t>(file));
+  active_ = !files_.empty();
+}
+
+bool AttributeCache::is_enabled(const file::File &file) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return files_.count(static_cast<hid_t>(file)) != 0;
+}
+
+bool AttributeCache::is_active() const noexcept
+{
+  return active_;
+}
+
+std::shared_ptr<const AttributeMap> AttributeCache::values(const node::Node &node)
+{
+  hid_t file = static_cast<hid_t>(node.link().file());
+  haddr_t address = object_address(static_cast<hid_t>(node));
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto entry = files_.find(file);
+    if(entry == files_.end())
+      throw_not_enabled(node);
+
+    auto iter = entry->second.objects.find(address);
+    if(iter != entry->second.objects.end())
+    {
+      ++hits_;
+      return iter->second;
+    }
+  }
+
+  ++misses_;
+  auto values = std::make_shared<const AttributeMap>(node.attributes.read_all());
+  insert(file,address,values);
+  return values;
+}
+
+void AttributeCache::warm(const node::Group &group)
+{
+  const file::File &file = group.link().file();
+  hid_t file_id = static_cast<hid_t>(file);
+  if(!is_enabled(file))
+    throw_not_enabled(group);
+
+  if(group.attributes.size())
+    values(group);
+
+  node::ScanOptions options;
+  options.dataset_details = false;
+  node::Catalogue catalogue = node::scan(group,options);
+
+  for(const auto &entry: catalogue.entries)
+  {
+    if(!entry.attributes)
+      continue;
+
+    {
+      std::shared_lock<std::shared_mutex> lock(mutex_);
+      auto file_entry = files_.find(file_id);
+      if(file_entry == files_.end() ||
+         file_entry->second.objects.count(entry.address))
+        continue;
+    }
+
+    hid_t object = H5Oopen_by_addr(file_id,entry.address);
+    if(object<0)
+    {
+      error::Singleton::instance().throw_with_stack(
+          "Failure opening object ["+entry.path+"]!");
+    }
+    Path path(entry.path);
+    node::Node node(ObjectHandle(object),
+                    node::Link(file,path.parent(),path.name()));
+    ++misses_;
+    insert(file_id,entry.address,
+           std::make_shared<const AttributeMap>(node.attributes.read_all()));
+  }
+}
+
+void AttributeCache::invalidate(const node::Node &node)
+{
+  invalidate(static_cast<hid_t>(node.link().file()),static_cast<hid_t>(node));
+}
+
+void AttributeCache::invalidate(const Attribute &attribute)
+{
+  invalidate(static_cast<hid_t>(attribute.parent_link().file()),
+             static_cast<hid_t>(attribute));
+}
+
+void AttributeCache::invalidate(hid_t file,hid_t object)
+{
+  if(!is_active())
+    return;
+
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto entry = files_.find(file);
+    if(entry == files_.end() || entry->second.objects.empty())
+      return;
+  }
+
+  haddr_t address = object_address(object);
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  auto entry = files_.find(file);
+  if(entry != files_.end())
+    entry->second.objects.erase(address);
+}
+
+void AttributeCache::insert(hid_t file,haddr_t address,
+                            std::shared_ptr<const AttributeMap> values)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  auto entry = files_.find(file);
+  if(entry != files_.end())
+    entry->second.objects[address] = std::move(values);
+}
+
+size_t AttributeCache::hits() const noexcept
+{
+  return hits_;
+}
+
+size_t AttributeCache::misses() const noexcept
+{
+  return misses_;
+}
+
+size_t AttributeCache::size() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  size_t size = 0;
+  for(const auto &entry: files_)
+    size += entry.second.objects.size();
+  return size;
+}
+
+void AttributeCache::clear()
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  files_.clear();
+  active_ = false;
+  hits_ = 0;
+  misses_ = 0;
+}
+
+} // namespace attribute
+} // namespace hdf5
@@ -0,0 +1,209 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <h5cpp/attribute/attribute_value.hpp>
+#include <h5cpp/core/hdf5_capi.hpp>
+#include <h5cpp/core/windows.hpp>
+#include <h5cpp/file/file.hpp>
+
+namespace hdf5 {
+
+namespace node {
+class Node;
+class Group;
+} // namespace node
+
+namespace attribute {
+
+class Attribute;
+
+//!
+//! \brief process-wide cache of decoded attribute values
+//!
+//! For files registered with enable() AttributeManager::value() reads all
+//! attributes of a node with AttributeManager::read_all() on first access
+//! and serves all further accesses to attributes of the same object from
+//! the cache. Objects are identified by their address, so all paths to an
+//! object share the same entry.
+//!
+//! The cache works on the file handle passed to enable(), which is shared
+//! by all copies of it and all nodes obtained from it. The cache keeps the
+//! file open until disable() is called.
+//!
+//! Entries are invalidated when attributes are created, written, renamed or
+//! removed via AttributeManager or Attribute. Changes made by other means
+//! are not noticed.
+//!
+//! All member functions are thread-safe.
+//!
+//! \code
+//! auto &cache = attribute::AttributeCache::instance();
+//! cache.enable(file);
+//! cache.warm(file.root());   // read the attributes of the whole file
+//! auto units = std::get<std::string>(dataset.attributes.value("units"));
+//! \endcode
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+class DLL_EXPORT AttributeCache
+{
+  public:
+    //!
+    //! \brief reference to the process-wide cache
+    //!
+    static AttributeCache &instance();
+
+    AttributeCache(const AttributeCache &) = delete;
+    AttributeCache &operator=(const AttributeCache &) = delete;
+
+    //!
+    //! \brief start caching attributes of a file
+    //!
+    //! Has no effect if caching is already enabled for the file.
+    //!
+    //! \throws std::runtime_error if the file is not valid
+    //! \param file the file
+    //!
+    void enable(const file::File &file);
+
+    //!
+    //! \brief stop caching attributes of a file
+    //!
+    //! Removes all entries of the file and releases its handle.
+    //!
+    //! \param file the file
+    //!
+    void disable(const file::File &file);
+
+    //!
+    //! \brief true if attributes of the file are cached
+    //!
+    //! \param file the file
+    //!
+    bool is_enabled(const file::File &file) const;
+
+    //!
+    //! \brief true if caching is enabled for any file
+    //!
+    bool is_active() const noexcept;
+
+    //!
+    //! \brief get the attribute values of a node
+    //!
+    //! Reads all attributes of the node if they are not cached yet.
+    //!
+    //! \throws std::runtime_error if caching is not enabled for the file of
+    //!                            the node or in case of a read failure
+    //! \param node the node
+    //! \return map with the decoded values of all attributes
+    //!
+    std::shared_ptr<const AttributeMap> values(const node::Node &node);
+
+    //!
+    //! \brief read the attributes of all objects of a subtree
+    //!
+    //! The objects are found with node::scan(). Only objects with at least
+    //! one attribute are read.
+    //!
+    //! \throws std::runtime_error if caching is not enabled for the file of
+    //!                            the group or in case of a failure
+    //! \param group the root of the subtree
+    //!
+    void warm(const node::Group &group);
+
+    //!
+    //! \brief remove the entry of a node
+    //!
+    //! \param node the node
+    //!
+    void invalidate(const node::Node &node);
+
+    //!
+    //! \brief remove the entry of the node an attribute is attached to
+    //!
+    //! \param attribute the attribute
+    //!
+    void invalidate(const Attribute &attribute);
+
+    //!
+    //! \brief number of lookups answered from the cache
+    //!
+    size_t hits() const noexcept;
+
+    //!
+    //! \brief number of lookups which had to read the attributes
+    //!
+    size_t misses() const noexcept;
+
+    //!
+    //! \brief number of cached objects over all files
+    //!
+    size_t size() const;
+
+    //!
+    //! \brief disable caching for all files and reset the counters
+    //!
+    void clear();
+
+  private:
+    AttributeCache();
+
+    using ObjectMap = std::unordered_map<haddr_t,std::shared_ptr<const AttributeMap>>;
+
+    struct FileEntry
+    {
+      file::File file;
+      ObjectMap objects;
+    };
+
+    void invalidate(hid_t file,hid_t object);
+    void insert(hid_t file,haddr_t address,
+                std::shared_ptr<const AttributeMap> values);
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<hid_t,FileEntry> files_;
+    std::atomic<bool> active_;
+    std::atomic<size_t> hits_;
+    std::atomic<size_t> misses_;
+};
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+} // namespace attribute
+} // namespace hdf5
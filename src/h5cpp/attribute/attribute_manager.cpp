@@ -23,10 +23,16 @@
 //          Sebastian Koenig <skoenig@ncsu.edu>
 // Created on: Oct 4, 2017
 //
+#include <exception>
 #include <sstream>
 #include <h5cpp/node/node.hpp>
 #include <h5cpp/attribute/attribute_manager.hpp>
+#include <h5cpp/attribute/attribute_cache.hpp>
 #include <h5cpp/attribute/attribute_iterator.hpp>
+#include <h5cpp/core/fixed_length_string.hpp>
+#include <h5cpp/dataspace/scalar.hpp>
+#include <h5cpp/dataspace/simple.hpp>
+#include <h5cpp/datatype/type_cache.hpp>
 #include <h5cpp/error/error.hpp>
 
 namespace hdf5 {
@@ -101,6 +107,7 @@ void AttributeManager::remove(const std::string &name) const
       <<node_.link().path()<<"]!";
     error::Singleton::instance().throw_with_stack(ss.str());
   }
+  AttributeCache::instance().invalidate(node_);
 }
 
 void AttributeManager::remove(size_t index) const
@@ -116,6 +123,7 @@ void AttributeManager::remove(size_t index) const
       <<node_.link().path()<<"]!";
     error::Singleton::instance().throw_with_stack(ss.str());
   }
+  AttributeCache::instance().invalidate(node_);
 }
 
 bool AttributeManager::exists(const std::string &name) const
@@ -157,6 +165,7 @@ Attribute AttributeManager::create(const std::string &name,
       <<node_.link().path()<<"]!";
     error::Singleton::instance().throw_with_stack(ss.str());
   }
+  AttributeCache::instance().invalidate(node_);
 
   return Attribute(ObjectHandle(id),node_.link());
 }
@@ -170,6 +179,302 @@ void AttributeManager::rename(const std::string &old_name,const std::string &new
       <<"on node ["<<node_.link().path()<<"]!";
     error::Singleton::instance().throw_with_stack(ss.str());
   }
+  AttributeCache::instance().invalidate(node_);
+}
+
+namespace {
+
+//
+// state shared by the callbacks of a single read_all() call
+//
+struct ReadAll
+{
+  AttributeMap &values;
+  std::vector<char> buffer;
+  std::exception_ptr error;
+};
+
+void throw_read_error(const std::string &name)
+{
+  error::Singleton::instance().throw_with_stack(
+      "Failure reading attribute ["+name+"]!");
+}
+
+template<typename T>
+AttributeValue read_numbers(hid_t attribute,hid_t mem_type,bool scalar,
+                            size_t size,const std::string &name)
+{
+  if(scalar)
+  {
+    T value{};
+    if(H5Aread(attribute,mem_type,&value)<0)
+      throw_read_error(name);
+    return value;
+  }
+
+  std::vector<T> values(size);
+  if(size && H5Aread(attribute,mem_type,values.data())<0)
+    throw_read_error(name);
+  return values;
+}
+
+AttributeValue read_strings(hid_t attribute,hid_t type,hid_t space,
+                            bool scalar,size_t size,const std::string &name,
+                            std::vector<char> &buffer)
+{
+  std::vector<std::string> values(size);
+  htri_t variable = H5Tis_variable_str(type);
+  if(variable<0)
+    throw_read_error(name);
+
+  if(variable)
+  {
+    std::vector<char*> pointers(size,nullptr);
+    if(size && H5Aread(attribute,type,pointers.data())<0)
+      throw_read_error(name);
+    for(size_t index = 0; index < size; ++index)
+      if(pointers[index])
+        values[index] = pointers[index];
+    if(size && H5Dvlen_reclaim(type,space,H5P_DEFAULT,pointers.data())<0)
+      throw_read_error(name);
+  }
+  else
+  {
+    size_t string_size = H5Tget_size(type);
+    buffer.resize(string_size * size);
+    if(size && H5Aread(attribute,type,buffer.data())<0)
+      throw_read_error(name);
+    auto pad = static_cast<datatype::StringPad>(H5Tget_strpad(type));
+    unpack_fixed_length_strings(buffer.data(),size,string_size,pad,true,
+                                values.data());
+  }
+
+  if(scalar)
+    return std::move(values.front());
+  return values;
+}
+
+void read_attribute(hid_t location,const char *name,ReadAll &read)
+{
+  ObjectHandle attribute(H5Aopen(location,name,H5P_DEFAULT));
+  ObjectHandle type(H5Aget_type(static_cast<hid_t>(attribute)));
+  ObjectHandle space(H5Aget_space(static_cast<hid_t>(attribute)));
+
+  H5S_class_t space_class = H5Sget_simple_extent_type(static_cast<hid_t>(space));
+  if(space_class!=H5S_SCALAR && space_class!=H5S_SIMPLE)
+    return;
+
+  bool scalar = space_class==H5S_SCALAR;
+  hssize_t points = H5Sget_simple_extent_npoints(static_cast<hid_t>(space));
+  if(points<0)
+    throw_read_error(name);
+  size_t size = static_cast<size_t>(points);
+
+  hid_t attribute_id = static_cast<hid_t>(attribute);
+  switch(H5Tget_class(static_cast<hid_t>(type)))
+  {
+    case H5T_INTEGER:
+      if(H5Tget_sign(static_cast<hid_t>(type))==H5T_SGN_NONE)
+        read.values[name] = read_numbers<std::uint64_t>(
+            attribute_id,H5T_NATIVE_UINT64,scalar,size,name);
+      else
+        read.values[name] = read_numbers<std::int64_t>(
+            attribute_id,H5T_NATIVE_INT64,scalar,size,name);
+      break;
+    case H5T_FLOAT:
+      read.values[name] = read_numbers<double>(
+          attribute_id,H5T_NATIVE_DOUBLE,scalar,size,name);
+      break;
+    case H5T_STRING:
+      read.values[name] = read_strings(attribute_id,static_cast<hid_t>(type),
+                                       static_cast<hid_t>(space),scalar,size,
+                                       name,read.buffer);
+      break;
+    default:
+      break;
+  }
+}
+
+herr_t read_attribute_callback(hid_t location,const char *name,
+                               const H5A_info_t *,void *op_data)
+{
+  auto read = static_cast<ReadAll*>(op_data);
+  try
+  {
+    read_attribute(location,name,*read);
+  }
+  catch(...)
+  {
+    // exceptions must not propagate through libhdf5
+    read->error = std::current_exception();
+    return -1;
+  }
+  return 0;
+}
+
+//
+// creates and writes a single attribute for write_batch()
+//
+class BatchWriter
+{
+  public:
+    BatchWriter(const node::Node &node,const dataspace::Scalar &scalar):
+      node_(node),
+      scalar_(scalar),
+      name_(nullptr)
+    {}
+
+    void write(const std::string &name,const AttributeValue &value)
+    {
+      name_ = &name;
+      std::visit(*this,value);
+    }
+
+    void operator()(const std::int64_t &value) const
+    {
+      write(H5T_NATIVE_INT64,static_cast<hid_t>(scalar_),&value);
+    }
+
+    void operator()(const std::uint64_t &value) const
+    {
+      write(H5T_NATIVE_UINT64,static_cast<hid_t>(scalar_),&value);
+    }
+
+    void operator()(const double &value) const
+    {
+      write(H5T_NATIVE_DOUBLE,static_cast<hid_t>(scalar_),&value);
+    }
+
+    void operator()(const std::string &value) const
+    {
+      const char *data = value.c_str();
+      write(string_type(),static_cast<hid_t>(scalar_),&data);
+    }
+
+    void operator()(const std::vector<std::int64_t> &values) const
+    {
+      write_vector(H5T_NATIVE_INT64,values.data(),values.size());
+    }
+
+    void operator()(const std::vector<std::uint64_t> &values) const
+    {
+      write_vector(H5T_NATIVE_UINT64,values.data(),values.size());
+    }
+
+    void operator()(const std::vector<double> &values) const
+    {
+      write_vector(H5T_NATIVE_DOUBLE,values.data(),values.size());
+    }
+
+    void operator()(const std::vector<std::string> &values) const
+    {
+      std::vector<const char*> data(values.size());
+      for(size_t index = 0; index < values.size(); ++index)
+        data[index] = values[index].c_str();
+      write_vector(string_type(),data.data(),data.size());
+    }
+
+  private:
+    const node::Node &node_;
+    const dataspace::Scalar &scalar_;
+    const std::string *name_;
+
+    static hid_t string_type()
+    {
+      return static_cast<hid_t>(datatype::TypeCache::instance().variable_string());
+    }
+
+    void write_vector(hid_t type,const void *data,size_t size) const
+    {
+      dataspace::Simple space(Dimensions{size});
+      write(type,static_cast<hid_t>(space),data);
+    }
+
+    void write(hid_t type,hid_t space,const void *data) const
+    {
+      hid_t location = static_cast<hid_t>(node_);
+      const std::string &name = *name_;
+
+      htri_t exists = H5Aexists(location,name.c_str());
+      if(exists<0 || (exists>0 && H5Adelete(location,name.c_str())<0))
+      {
+        error::Singleton::instance().throw_with_stack(
+            "Failure replacing attribute ["+name+"]!");
+      }
+
+      hid_t id = H5Acreate2(location,name.c_str(),type,space,H5P_DEFAULT,
+                            H5P_DEFAULT);
+      if(id<0)
+      {
+        error::Singleton::instance().throw_with_stack(
+            "Failure creating attribute ["+name+"]!");
+      }
+      ObjectHandle attribute(id);
+      if(H5Awrite(id,type,data)<0)
+      {
+        error::Singleton::instance().throw_with_stack(
+            "Failure writing attribute ["+name+"]!");
+      }
+    }
+};
+
+} // anonymous namespace
+
+AttributeMap AttributeManager::read_all() const
+{
+  AttributeMap values;
+  ReadAll read{values,{},nullptr};
+
+  hsize_t index = 0;
+  herr_t status = H5Aiterate2(static_cast<hid_t>(node_),
+                              static_cast<H5_index_t>(iter_config_.index()),
+                              static_cast<H5_iter_order_t>(iter_config_.order()),
+                              &index,read_attribute_callback,&read);
+  if(read.error)
+    std::rethrow_exception(read.error);
+  if(status<0)
+  {
+    std::stringstream ss;
+    ss<<"Failure reading the attributes of node ["<<node_.link().path()<<"]!";
+    error::Singleton::instance().throw_with_stack(ss.str());
+  }
+
+  return values;
+}
+
+void AttributeManager::write_batch(const AttributeMap &attributes) const
+{
+  dataspace::Scalar scalar;
+  BatchWriter writer(node_,scalar);
+  for(const auto &attribute: attributes)
+    writer.write(attribute.first,attribute.second);
+  AttributeCache::instance().invalidate(node_);
+}
+
+AttributeValue AttributeManager::value(const std::string &name) const
+{
+  AttributeCache &cache = AttributeCache::instance();
+  if(cache.is_active() && cache.is_enabled(node_.link().file()))
+  {
+    auto values = cache.values(node_);
+    auto iter = values->find(name);
+    if(iter != values->end())
+      return iter->second;
+  }
+  else if(exists(name))
+  {
+    AttributeMap values;
+    ReadAll read{values,{},nullptr};
+    read_attribute(static_cast<hid_t>(node_),name.c_str(),read);
+    auto iter = values.find(name);
+    if(iter != values.end())
+      return std::move(iter->second);
+  }
+
+  std::stringstream ss;
+  ss<<"Attribute ["<<name<<"] of node ["<<node_.link().path()
+    <<"] does not exist or is of an unsupported type!";
+  throw std::runtime_error(ss.str());
 }
 
 IteratorConfig &AttributeManager::iterator_config() noexcept
@@ -28,6 +28,7 @@
 
 #include <string>
 #include <h5cpp/attribute/attribute.hpp>
+#include <h5cpp/attribute/attribute_value.hpp>
 #include <h5cpp/core/types.hpp>
 #include <h5cpp/core/windows.hpp>
 #include <h5cpp/core/iterator_config.hpp>
@@ -128,6 +129,47 @@ class DLL_EXPORT AttributeManager
     //!
     void rename(const std::string &old_name,const std::string &new_name) const;
 
+    //!
+    //! \brief read all attributes
+    //!
+    //! Reads the integer, floating point and string attributes of the node
+    //! in a single H5Aiterate pass. Values are converted by libhdf5 into
+    //! the native types of AttributeValue, no datatype or dataspace objects
+    //! are created. Attributes of other types or with a null dataspace are
+    //! skipped.
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \return map with the values of the attributes
+    //!
+    AttributeMap read_all() const;
+
+    //!
+    //! \brief read the value of a single attribute
+    //!
+    //! Decodes the attribute like read_all(). If the AttributeCache is
+    //! enabled for the file of the node the value is taken from the cache,
+    //! which reads all attributes of the node on first access.
+    //!
+    //! \throws std::runtime_error if the attribute does not exist, is of an
+    //!                            unsupported type or in case of a failure
+    //! \param name the name of the attribute
+    //! \return the value of the attribute
+    //!
+    AttributeValue value(const std::string &name) const;
+
+    //!
+    //! \brief write several attributes
+    //!
+    //! Creates one attribute for every entry of the map. Existing attributes
+    //! of the same name are replaced. Integers are stored as 64-bit native
+    //! integers, floating point numbers as doubles and strings as variable
+    //! length ASCII strings.
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param attributes the attributes to write
+    //!
+    void write_batch(const AttributeMap &attributes) const;
+
     //!
     //! \brief create an attribute
     //!
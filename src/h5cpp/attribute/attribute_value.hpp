@@ -0,0 +1,62 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace hdf5 {
+namespace attribute {
+
+//!
+//! \brief decoded value of an attribute
+//!
+//! Attributes with a scalar dataspace are stored as single values. Those
+//! with a simple dataspace are stored as vectors in row major order. Signed
+//! integers are converted to std::int64_t, unsigned integers to
+//! std::uint64_t and floating point numbers to double. Fixed and variable
+//! length strings are both stored as std::string.
+//!
+using AttributeValue = std::variant<std::int64_t,
+                                    std::uint64_t,
+                                    double,
+                                    std::string,
+                                    std::vector<std::int64_t>,
+                                    std::vector<std::uint64_t>,
+                                    std::vector<double>,
+                                    std::vector<std::string>>;
+
+//!
+//! \brief attribute values by name
+//!
+//! \sa AttributeManager::read_all
+//! \sa AttributeManager::write_batch
+//!
+using AttributeMap = std::map<std::string,AttributeValue>;
+
+} // namespace attribute
+} // namespace hdf5
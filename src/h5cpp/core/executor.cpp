@@ -0,0 +1,103 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+
+#include <stdexcept>
+#include <h5cpp/core/executor.hpp>
+
+namespace hdf5 {
+namespace concurrency {
+
+namespace {
+
+// nesting depth of run() on the current thread
+thread_local size_t execution_depth = 0;
+
+} // anonymous namespace
+
+Executor::Scope::Scope()
+{
+  ++execution_depth;
+}
+
+Executor::Scope::~Scope()
+{
+  --execution_depth;
+}
+
+Executor &Executor::instance()
+{
+  static Executor executor;
+  return executor;
+}
+
+Executor::Executor():
+    mutex_(),
+    worker_mutex_(),
+    worker_(nullptr),
+    mode_(ExecutionMode::GlobalMutex)
+{}
+
+ExecutionMode Executor::mode() const noexcept
+{
+  return mode_;
+}
+
+void Executor::mode(ExecutionMode mode)
+{
+  if(is_executing())
+    throw std::logic_error("Cannot change the execution mode from within Executor::run()!");
+
+  std::shared_ptr<TaskQueue> previous;
+  {
+    // wait for the calls holding the mutex
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    std::lock_guard<std::mutex> worker_lock(worker_mutex_);
+    if(mode == mode_)
+      return;
+
+    if(mode == ExecutionMode::SerializedWorker)
+      worker_ = std::make_shared<TaskQueue>();
+    else
+      previous = std::move(worker_);
+    mode_ = mode;
+  }
+
+  // the pending calls of the previous worker need the mutex
+  if(previous)
+    previous->wait();
+}
+
+std::shared_ptr<TaskQueue> Executor::worker() const
+{
+  std::lock_guard<std::mutex> lock(worker_mutex_);
+  return worker_;
+}
+
+bool Executor::is_executing() const
+{
+  return execution_depth > 0;
+}
+
+} // namespace concurrency
+} // namespace hdf5
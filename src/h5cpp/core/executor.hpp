@@ -0,0 +1,197 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <h5cpp/core/task_queue.hpp>
+#include <h5cpp/core/windows.hpp>
+
+namespace hdf5 {
+namespace concurrency {
+
+//!
+//! \brief how an Executor serializes HDF5 calls
+//!
+enum class ExecutionMode
+{
+  //! HDF5 calls are executed on the calling thread holding a global mutex
+  GlobalMutex,
+  //! HDF5 calls are executed on a single dedicated worker thread
+  SerializedWorker
+};
+
+//!
+//! \brief serialized execution of HDF5 calls
+//!
+//! libhdf5 is not safe for concurrent use unless it is built thread-safe,
+//! in which case all calls are serialized on a global lock anyway. The
+//! Executor provides the serialization in h5cpp: all HDF5 calls passed to
+//! run() are executed one after the other, either on the calling thread
+//! while holding a process-wide mutex or on a single dedicated worker
+//! thread. The components of h5cpp which use threads (AsyncDataset,
+//! WriteBehindDataset, ChunkReader and ChunkWriter) issue their HDF5 calls
+//! through the Executor. Applications calling HDF5 from several threads
+//! should wrap their calls the same way.
+//!
+//! Only the HDF5 calls made inside run() are serialized. All other uses of
+//! h5cpp call libhdf5 directly on the calling thread, including copying
+//! and destroying objects which hold an HDF5 handle (Dataset, Datatype,
+//! property lists, ...), which changes the reference count of the handle,
+//! and the ordinary methods of Dataset, Group, Attribute and so on. The
+//! threaded components only route the calls of their I/O methods through
+//! run(); their constructors and destructors call libhdf5 on the calling
+//! thread. Unless libhdf5 is built thread-safe, an application using the
+//! Executor from several threads must wrap all of these in run() as well.
+//!
+//! Only the HDF5 calls themselves should be passed to run(). The CPU heavy
+//! work around them - type conversion, packing buffers, compression - can
+//! then run in parallel on the threads of the callers.
+//!
+//! \code
+//! auto &executor = concurrency::Executor::instance();
+//! std::vector<float> frame = acquire_and_convert();   // in parallel
+//! executor.run([&]() { dataset.write(frame,selection); });
+//! \endcode
+//!
+//! Calls to run() may be nested. The mode may be changed while other
+//! threads execute calls. Calls already submitted to the worker thread
+//! finish there and stay serialized with all later calls.
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+class DLL_EXPORT Executor
+{
+  public:
+    //!
+    //! \brief reference to the process-wide executor
+    //!
+    //! The executor starts in ExecutionMode::GlobalMutex.
+    //!
+    static Executor &instance();
+
+    Executor(const Executor &) = delete;
+    Executor &operator=(const Executor &) = delete;
+
+    //!
+    //! \brief get the execution mode
+    //!
+    ExecutionMode mode() const noexcept;
+
+    //!
+    //! \brief set the execution mode
+    //!
+    //! Waits for the worker thread to finish all pending calls when leaving
+    //! ExecutionMode::SerializedWorker.
+    //!
+    //! \throws std::logic_error if called from within run()
+    //! \param mode the new execution mode
+    //!
+    void mode(ExecutionMode mode);
+
+    //!
+    //! \brief execute a callable serialized with all other HDF5 calls
+    //!
+    //! Blocks until the callable has finished. Its return value is
+    //! returned and exceptions thrown by it are rethrown.
+    //!
+    //! \tparam F callable type
+    //! \param function the callable to execute
+    //! \return the return value of the callable
+    //!
+    template<typename F>
+    auto run(F &&function) -> decltype(function());
+
+    //!
+    //! \brief true if called from within run()
+    //!
+    bool is_executing() const;
+
+  private:
+    Executor();
+
+    class Scope;
+
+    //
+    // returns the worker in ExecutionMode::SerializedWorker, otherwise a
+    // null pointer
+    //
+    std::shared_ptr<TaskQueue> worker() const;
+
+    std::recursive_mutex mutex_;
+    mutable std::mutex worker_mutex_;
+    std::shared_ptr<TaskQueue> worker_;
+    std::atomic<ExecutionMode> mode_;
+};
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+//!
+//! \brief marks the current thread as executing a call
+//!
+class DLL_EXPORT Executor::Scope
+{
+  public:
+    Scope();
+    ~Scope();
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+};
+
+template<typename F>
+auto Executor::run(F &&function) -> decltype(function())
+{
+  // the worker is kept alive until the call has finished, even if the
+  // mode is changed in the meantime
+  std::shared_ptr<TaskQueue> worker = this->worker();
+  if(worker && !worker->is_worker_thread())
+  {
+    return worker->submit([this,&function]()
+    {
+      // serializes calls left on a retired worker with the new mode
+      std::lock_guard<std::recursive_mutex> lock(mutex_);
+      Scope scope;
+      return function();
+    }).get();
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  Scope scope;
+  return function();
+}
+
+} // namespace concurrency
+} // namespace hdf5
@@ -25,6 +25,9 @@
 //
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <h5cpp/dataspace/dataspace.hpp>
@@ -33,6 +36,89 @@
 
 namespace hdf5 {
 
+//!
+//! \brief length of a fixed length string without its padding
+//!
+//! For null terminated and null padded strings this is the position of
+//! the first null character (found with memchr). For space padded strings
+//! trailing spaces are skipped eight bytes at a time.
+//!
+//! \param data pointer to the first character of the string
+//! \param size size of the fixed length string type
+//! \param pad the padding of the string type
+//! \return number of characters before the padding
+//!
+inline size_t fixed_length_string_size(const char *data,size_t size,
+                                       datatype::StringPad pad)
+{
+  if(pad == datatype::StringPad::SpacePad)
+  {
+    const std::uint64_t spaces = 0x2020202020202020ull;
+    size_t end = size;
+    for(std::uint64_t word; end >= sizeof(word); end -= sizeof(word))
+    {
+      std::memcpy(&word,data + end - sizeof(word),sizeof(word));
+      if(word != spaces)
+        break;
+    }
+    while(end > 0 && data[end - 1] == ' ')
+      --end;
+    return end;
+  }
+
+  const void *null = std::memchr(data,'\0',size);
+  return null ? static_cast<size_t>(static_cast<const char*>(null) - data) : size;
+}
+
+//!
+//! \brief pack strings into a fixed length string buffer
+//!
+//! Every string is copied with a single memcpy and truncated to the size of
+//! the string type. The remainder of each element is filled with spaces
+//! for space padded types and with null characters otherwise.
+//!
+//! \param first pointer to the first string
+//! \param count number of strings
+//! \param size size of the fixed length string type
+//! \param pad the padding of the string type
+//! \param buffer destination with room for count*size characters
+//!
+inline void pack_fixed_length_strings(const std::string *first,size_t count,
+                                      size_t size,datatype::StringPad pad,
+                                      char *buffer)
+{
+  const int fill = pad == datatype::StringPad::SpacePad ? ' ' : '\0';
+  for(const std::string *last = first + count; first != last; ++first,buffer += size)
+  {
+    size_t length = std::min(first->size(),size);
+    std::memcpy(buffer,first->data(),length);
+    std::memset(buffer + length,fill,size - length);
+  }
+}
+
+//!
+//! \brief unpack strings from a fixed length string buffer
+//!
+//! The strings are assigned in place to existing strings, reusing their
+//! memory. If trim is true the padding is removed, see
+//! fixed_length_string_size(). Otherwise every string has the size of the
+//! string type.
+//!
+//! \param buffer the fixed length string buffer
+//! \param count number of strings
+//! \param size size of the fixed length string type
+//! \param pad the padding of the string type
+//! \param trim remove the padding if true
+//! \param first pointer to the first destination string
+//!
+inline void unpack_fixed_length_strings(const char *buffer,size_t count,
+                                        size_t size,datatype::StringPad pad,
+                                        bool trim,std::string *first)
+{
+  for(std::string *last = first + count; first != last; ++first,buffer += size)
+    first->assign(buffer,trim ? fixed_length_string_size(buffer,size,pad) : size);
+}
+
 template<typename CharT>
 class FixedLengthStringBuffer : public  std::vector<CharT>
 {
@@ -76,6 +162,14 @@ struct FixedLengthStringTrait
     {
       return DataType();
     }
+
+    static void from_buffer(const BufferType &buffer,
+                            const datatype::String &memory_type,
+                            const dataspace::Dataspace &memory_space,
+                            DataType &data)
+    {
+      data = from_buffer(buffer,memory_type,memory_space);
+    }
 };
 
 template<>
@@ -100,13 +194,10 @@ struct FixedLengthStringTrait<std::string>
     {
       BufferType buffer = BufferType::create(memory_type,memory_space);
 
-      auto buffer_iter = buffer.begin();
-      auto buffer_end  = buffer.end();
-      auto data_iter   = data.begin();
-      auto data_end    = data.end();
-
-      for(;buffer_iter!=buffer_end && data_iter != data_end; ++buffer_iter,++data_iter)
-        *buffer_iter = *data_iter;
+      size_t length = std::min(data.size(),buffer.size());
+      std::memcpy(buffer.data(),data.data(),length);
+      if(memory_type.padding() == datatype::StringPad::SpacePad)
+        std::fill(buffer.begin() + unsigned2signed<ssize_t>(length),buffer.end(),' ');
 
       return buffer;
     }
@@ -122,6 +213,20 @@ struct FixedLengthStringTrait<std::string>
     {
       return DataType(buffer.begin(),buffer.end());
     }
+
+    //!
+    //! @brief store data from buffer in an existing string
+    //!
+    //! @param buffer reference to the IO buffer
+    //! @param data the string receiving the data
+    //!
+    static void from_buffer(const BufferType &buffer,
+                            const datatype::String &,
+                            const dataspace::Dataspace &,
+                            DataType &data)
+    {
+      data.assign(buffer.data(),buffer.size());
+    }
 };
 
 template<>
@@ -136,31 +241,40 @@ struct FixedLengthStringTrait<std::vector<std::string>>
    {
      BufferType buffer = BufferType::create(memory_type,memory_space);
 
-     auto iter = buffer.begin();
-     for(const auto &str: data)
-     {
-       std::copy(str.begin(),str.end(),iter);
-       std::advance(iter,unsigned2signed<ssize_t>(memory_type.size())); //move iterator to the next position
-     }
+     size_t size = memory_type.size();
+     if(size)
+       pack_fixed_length_strings(data.data(),std::min(data.size(),buffer.size() / size),
+                                 size,memory_type.padding(),buffer.data());
 
      return buffer;
    }
 
    static DataType from_buffer(const BufferType &buffer,
                                const datatype::String &memory_type,
-                               const dataspace::Dataspace &)
+                               const dataspace::Dataspace &memory_space)
    {
      DataType data;
-
-     auto start=buffer.begin();
-     while(start!=buffer.end())
-     {
-       auto end = start+unsigned2signed<std::string::difference_type>(memory_type.size());
-       data.push_back(std::string(start,end));
-       start=end;
-     }
+     from_buffer(buffer,memory_type,memory_space,data);
      return data;
    }
+
+   //!
+   //! @brief store data from buffer in existing strings
+   //!
+   //! The vector is resized to the number of strings in the buffer. The
+   //! padding is kept, so every string has the size of the string type.
+   //!
+   static void from_buffer(const BufferType &buffer,
+                           const datatype::String &memory_type,
+                           const dataspace::Dataspace &,
+                           DataType &data)
+   {
+     size_t size = memory_type.size();
+     size_t count = size ? buffer.size() / size : 0;
+     data.resize(count);
+     unpack_fixed_length_strings(buffer.data(),count,size,memory_type.padding(),
+                                 false,data.data());
+   }
 };
 
 
@@ -0,0 +1,119 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+
+#include <algorithm>
+#include <new>
+#include <h5cpp/core/string_arena.hpp>
+#include <h5cpp/error/error.hpp>
+
+namespace hdf5 {
+
+namespace {
+
+const size_t alignment = alignof(std::max_align_t);
+
+size_t align(size_t size)
+{
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+} // anonymous namespace
+
+StringArena::StringArena(size_t block_size):
+    blocks_(),
+    next_block_size_(std::max(align(block_size),alignment)),
+    used_(0),
+    size_(0),
+    capacity_(0)
+{}
+
+void *StringArena::allocate(size_t size)
+{
+  size = align(std::max<size_t>(size,1));
+  if(blocks_.empty() || used_ + size > blocks_.back().size)
+  {
+    size_t block_size = std::max(next_block_size_,size);
+    blocks_.push_back(Block{std::unique_ptr<unsigned char[]>(
+                                new unsigned char[block_size]),block_size});
+    next_block_size_ = 2 * block_size;
+    capacity_ += block_size;
+    used_ = 0;
+  }
+
+  void *memory = blocks_.back().data.get() + used_;
+  used_ += size;
+  size_ += size;
+  return memory;
+}
+
+void StringArena::clear()
+{
+  if(blocks_.size() > 1)
+  {
+    // keep the largest block which is the last one
+    Block block = std::move(blocks_.back());
+    blocks_.clear();
+    blocks_.push_back(std::move(block));
+    capacity_ = blocks_.back().size;
+  }
+  used_ = 0;
+  size_ = 0;
+}
+
+size_t StringArena::size() const noexcept
+{
+  return size_;
+}
+
+size_t StringArena::capacity() const noexcept
+{
+  return capacity_;
+}
+
+void *StringArena::allocate_callback(size_t size,void *arena)
+{
+  try
+  {
+    return static_cast<StringArena*>(arena)->allocate(size);
+  }
+  catch(const std::bad_alloc &)
+  {
+    // reported as an allocation failure by libhdf5
+    return nullptr;
+  }
+}
+
+void StringArena::free_callback(void *,void *)
+{}
+
+void StringArena::install(hid_t dtpl)
+{
+  if(H5Pset_vlen_mem_manager(dtpl,allocate_callback,this,free_callback,this)<0)
+  {
+    error::Singleton::instance().throw_with_stack(
+        "Failure to install a string arena as variable length memory manager!");
+  }
+}
+
+} // namespace hdf5
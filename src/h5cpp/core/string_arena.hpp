@@ -0,0 +1,142 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <h5cpp/core/hdf5_capi.hpp>
+#include <h5cpp/core/windows.hpp>
+
+namespace hdf5 {
+
+//!
+//! \brief bump allocator for variable length data
+//!
+//! A StringArena hands out memory from large blocks. Allocating is a
+//! pointer increment, and individual allocations are never freed. All
+//! memory is released at once by clear() or by the destructor. libhdf5 can
+//! be told to use an arena when it allocates variable length data during
+//! a read (see install()). This avoids one malloc() and one free() per
+//! element when reading large variable length string datasets.
+//!
+//! Block sizes double for every new block, starting at the initial block
+//! size, so the number of blocks grows only logarithmically with the
+//! amount of data.
+//!
+//! An arena must outlive all pointers into its memory. It is not
+//! thread-safe.
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+class DLL_EXPORT StringArena
+{
+  public:
+    //!
+    //! \brief constructor
+    //!
+    //! No memory is allocated before the first call to allocate().
+    //!
+    //! \param block_size size of the first block in bytes
+    //!
+    explicit StringArena(size_t block_size = 64 * 1024);
+
+    StringArena(const StringArena &) = delete;
+    StringArena &operator=(const StringArena &) = delete;
+    StringArena(StringArena &&) = default;
+    StringArena &operator=(StringArena &&) = default;
+
+    //!
+    //! \brief allocate memory
+    //!
+    //! The returned memory is suitably aligned for any fundamental type.
+    //!
+    //! \throws std::bad_alloc if no memory is available
+    //! \param size number of bytes
+    //! \return pointer to the memory
+    //!
+    void *allocate(size_t size);
+
+    //!
+    //! \brief release all memory
+    //!
+    //! Invalidates all pointers handed out by the arena. The largest block
+    //! is kept for reuse.
+    //!
+    void clear();
+
+    //!
+    //! \brief number of bytes handed out since the last clear()
+    //!
+    size_t size() const noexcept;
+
+    //!
+    //! \brief number of bytes held by the arena
+    //!
+    size_t capacity() const noexcept;
+
+    //!
+    //! \brief install the arena as variable length memory manager
+    //!
+    //! Sets the allocation functions of a dataset transfer property list
+    //! with \c H5Pset_vlen_mem_manager. Variable length data read with this
+    //! property list is allocated from the arena. The free function does
+    //! nothing, so such data must not be reclaimed with
+    //! \c H5Dvlen_reclaim.
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param dtpl handle of a dataset transfer property list
+    //!
+    void install(hid_t dtpl);
+
+  private:
+    struct Block
+    {
+      std::unique_ptr<unsigned char[]> data;
+      size_t size;
+    };
+
+    static void *allocate_callback(size_t size,void *arena);
+    static void free_callback(void *memory,void *arena);
+
+    std::vector<Block> blocks_;
+    size_t next_block_size_;
+    size_t used_;
+    size_t size_;
+    size_t capacity_;
+};
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+} // namespace hdf5
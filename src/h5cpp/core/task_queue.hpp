@@ -0,0 +1,53 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <h5cpp/core/thread_pool.hpp>
+#include <h5cpp/core/windows.hpp>
+
+namespace hdf5 {
+
+//!
+//! \brief single threaded FIFO task queue
+//!
+//! A TaskQueue is a ThreadPool with exactly one worker thread. Submitted
+//! tasks are thus executed strictly in the order of submission. It is used
+//! wherever h5cpp moves HDF5 calls off the calling thread, as all HDF5 calls
+//! issued through one queue are serialized and ordered.
+//!
+//! The destructor waits for all pending tasks to finish before the worker
+//! thread is joined.
+//!
+class DLL_EXPORT TaskQueue : public ThreadPool
+{
+  public:
+    //!
+    //! \brief constructor
+    //!
+    //! Starts the worker thread.
+    //!
+    TaskQueue();
+};
+
+} // namespace hdf5
@@ -0,0 +1,123 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+
+#include <algorithm>
+#include <stdexcept>
+#include <h5cpp/core/thread_pool.hpp>
+
+namespace hdf5 {
+
+ThreadPool::ThreadPool(size_t threads):
+    mutex_(),
+    task_available_(),
+    queue_drained_(),
+    tasks_(),
+    pending_(0),
+    stop_(false),
+    workers_()
+{
+  if(threads == 0)
+    threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+  for(size_t index = 0; index < threads; ++index)
+    workers_.emplace_back(&ThreadPool::run, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  task_available_.notify_all();
+  for(auto &worker: workers_)
+  {
+    if(worker.joinable())
+      worker.join();
+  }
+}
+
+void ThreadPool::push(std::function<void()> &&task)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+    ++pending_;
+  }
+  task_available_.notify_one();
+}
+
+void ThreadPool::wait() const
+{
+  if(is_worker_thread())
+    throw std::logic_error("Waiting for a thread pool from one of its own tasks!");
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  queue_drained_.wait(lock, [this]() { return pending_ == 0; });
+}
+
+size_t ThreadPool::pending() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return pending_;
+}
+
+size_t ThreadPool::size() const noexcept
+{
+  return workers_.size();
+}
+
+bool ThreadPool::is_worker_thread() const
+{
+  auto id = std::this_thread::get_id();
+  return std::any_of(workers_.begin(), workers_.end(),
+                     [id](const std::thread &worker)
+                     { return worker.get_id() == id; });
+}
+
+void ThreadPool::run()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while(true)
+  {
+    task_available_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+    // pending tasks are always finished before the workers terminate
+    if(tasks_.empty())
+      break;
+
+    std::function<void()> task = std::move(tasks_.front());
+    tasks_.pop_front();
+    lock.unlock();
+    // exceptions are captured by the packaged task and not seen here
+    task();
+    // destroy captured state (buffers, HDF5 handles) on the worker thread
+    task = nullptr;
+    lock.lock();
+
+    if(--pending_ == 0)
+      queue_drained_.notify_all();
+  }
+}
+
+} // namespace hdf5
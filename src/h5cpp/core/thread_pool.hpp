@@ -0,0 +1,145 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <h5cpp/core/windows.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hdf5 {
+
+//!
+//! \brief pool of worker threads
+//!
+//! A ThreadPool executes submitted tasks on a fixed number of worker
+//! threads. Tasks are started in the order of submission but, with more
+//! than one worker, may finish in any order. It is used to parallelize the
+//! CPU heavy work around HDF5 calls, for instance chunk compression.
+//!
+//! The destructor waits for all pending tasks to finish before the worker
+//! threads are joined.
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+class DLL_EXPORT ThreadPool
+{
+  public:
+    //!
+    //! \brief constructor
+    //!
+    //! Starts the worker threads.
+    //!
+    //! \param threads number of worker threads - if 0 the number of
+    //!                hardware threads is used
+    //!
+    explicit ThreadPool(size_t threads = 0);
+
+    //!
+    //! \brief destructor
+    //!
+    //! Finishes all pending tasks and joins the worker threads.
+    //!
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    //!
+    //! \brief submit a new task
+    //!
+    //! The return value of the callable (or any exception it throws) is
+    //! delivered via the returned future.
+    //!
+    //! \tparam F callable type
+    //! \param function the callable to execute
+    //! \return future for the result of the callable
+    //!
+    template<typename F>
+    auto submit(F &&function) -> std::future<decltype(function())>;
+
+    //!
+    //! \brief block until the pool is idle
+    //!
+    //! Returns once all tasks submitted before the call have finished.
+    //!
+    //! \throws std::logic_error if called from one of the worker threads
+    //!
+    void wait() const;
+
+    //!
+    //! \brief number of tasks not yet finished
+    //!
+    //! This includes the tasks currently running on the worker threads.
+    //!
+    size_t pending() const;
+
+    //!
+    //! \brief number of worker threads
+    //!
+    size_t size() const noexcept;
+
+    //!
+    //! \brief true if called from one of the worker threads of this pool
+    //!
+    bool is_worker_thread() const;
+
+  private:
+    void push(std::function<void()> &&task);
+    void run();
+
+    mutable std::mutex mutex_;
+    mutable std::condition_variable task_available_;
+    mutable std::condition_variable queue_drained_;
+    std::deque<std::function<void()>> tasks_;
+    size_t pending_;
+    bool stop_;
+    std::vector<std::thread> workers_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+template<typename F>
+auto ThreadPool::submit(F &&function) -> std::future<decltype(function())>
+{
+  using ResultType = decltype(function());
+
+  // std::function requires copyable targets - the packaged task is shared
+  auto task = std::make_shared<std::packaged_task<ResultType()>>(
+      std::forward<F>(function));
+  auto future = task->get_future();
+  push([task]() { (*task)(); });
+  return future;
+}
+
+} // namespace hdf5
@@ -0,0 +1,3 @@
+#pragma once
+
+#define H5CPP_WITH_BOOST
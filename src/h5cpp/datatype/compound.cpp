@@ -159,5 +159,27 @@ void Compound::pack() const {
   }
 }
 
+bool Compound::is_layout_identical(const Datatype &other) const {
+  hid_t id = static_cast<hid_t>(*this);
+  hid_t other_id = static_cast<hid_t>(other);
+  if (H5Tget_class(other_id) != H5T_COMPOUND || H5Tget_size(id) != H5Tget_size(other_id))
+    return false;
+
+  int n = H5Tget_nmembers(id);
+  if (n < 0 || n != H5Tget_nmembers(other_id))
+    return false;
+
+  for (unsigned index = 0; index < static_cast<unsigned>(n); ++index) {
+    if (H5Tget_member_offset(id, index) != H5Tget_member_offset(other_id, index))
+      return false;
+
+    ObjectHandle type(H5Tget_member_type(id, index));
+    ObjectHandle other_type(H5Tget_member_type(other_id, index));
+    if (H5Tequal(static_cast<hid_t>(type), static_cast<hid_t>(other_type)) <= 0)
+      return false;
+  }
+  return true;
+}
+
 } // namespace datatype
 } // namespace hdf5
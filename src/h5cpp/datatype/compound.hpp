@@ -95,6 +95,21 @@ class DLL_EXPORT Compound : public Datatype {
 
   void pack() const;
 
+  //!
+  //! \brief true if other has the same memory layout
+  //!
+  //! Two compound types have the same layout if they have the same size
+  //! and the same number of fields, and if every field has the same offset
+  //! and an equal datatype as the field with the same index in the other
+  //! type. Field names are not compared, so a byte by byte copy between
+  //! two types with identical layout may move values to differently named
+  //! fields.
+  //!
+  //! \param other the type to compare with
+  //! \return true if the layouts are identical, false otherwise
+  //!
+  bool is_layout_identical(const Datatype &other) const;
+
 };
 #ifdef __clang__
 #pragma clang diagnostic pop
@@ -0,0 +1,297 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <h5cpp/datatype/compound.hpp>
+#include <h5cpp/datatype/type_trait.hpp>
+
+namespace hdf5 {
+namespace datatype {
+
+//!
+//! \brief description of a single field of a reflected compound type
+//!
+//! Instances are generated by the H5CPP_COMPOUND macro.
+//!
+struct CompoundField
+{
+  //!
+  //! \brief name of the field in the compound type
+  //!
+  const char *name;
+
+  //!
+  //! \brief offset of the field in bytes
+  //!
+  size_t offset;
+
+  //!
+  //! \brief size of the field in bytes
+  //!
+  size_t size;
+
+  //!
+  //! \brief function creating the HDF5 datatype of the field
+  //!
+  Datatype (*type)();
+};
+
+//!
+//! \brief create the datatype of a compound field
+//!
+template<typename T>
+Datatype compound_field_type()
+{
+  return TypeTrait<T>::create();
+}
+
+//!
+//! \brief field list of a reflected compound type
+//!
+//! Specializations are generated by the H5CPP_COMPOUND macro and provide a
+//! static constexpr array \c fields of CompoundField instances. The primary
+//! template is never defined.
+//!
+template<typename T>
+struct CompoundLayout;
+
+//!
+//! \brief true if the fields are ordered, disjoint and inside the type
+//!
+//! \param fields the fields of a compound type
+//! \param type_size the size of the C++ type
+//!
+template<size_t N>
+constexpr bool compound_fields_valid(const CompoundField (&fields)[N],
+                                     size_t type_size)
+{
+  size_t end = 0;
+  for(size_t index = 0; index < N; ++index)
+  {
+    if(fields[index].offset < end)
+      return false;
+    end = fields[index].offset + fields[index].size;
+  }
+  return end <= type_size;
+}
+
+//!
+//! \brief true if the fields cover the type without any padding
+//!
+//! \param fields the fields of a compound type
+//! \param type_size the size of the C++ type
+//!
+template<size_t N>
+constexpr bool compound_fields_packed(const CompoundField (&fields)[N],
+                                      size_t type_size)
+{
+  size_t size = 0;
+  for(size_t index = 0; index < N; ++index)
+    size += fields[index].size;
+  return size == type_size;
+}
+
+//!
+//! \brief type trait for compound types with a CompoundLayout
+//!
+//! The HDF5 compound type is built from the field list of
+//! CompoundLayout<T>. The layout is checked at compile time: the type must
+//! be trivially copyable with standard layout, and its fields must be
+//! listed in declaration order without overlapping. A type without padding
+//! between or after its fields is reported by \c packed.
+//!
+//! Use the H5CPP_COMPOUND macro instead of deriving from this template
+//! directly.
+//!
+//! \tparam T the C++ type of the compound
+//!
+template<typename T>
+class CompoundTypeTrait
+{
+  public:
+    using Type = T;
+    using TypeClass = Compound;
+
+    static_assert(std::is_standard_layout<T>::value,
+                  "compound types must have standard layout");
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "compound types must be trivially copyable");
+    static_assert(compound_fields_valid(CompoundLayout<T>::fields,sizeof(T)),
+                  "compound fields must be listed in declaration order");
+
+    //!
+    //! \brief true if the type has no padding
+    //!
+    static constexpr bool packed =
+        compound_fields_packed(CompoundLayout<T>::fields,sizeof(T));
+
+    static TypeClass create(const Type & = Type())
+    {
+      auto type = Compound::create(sizeof(T));
+      for(const auto &field: CompoundLayout<T>::fields)
+        type.insert(field.name,field.offset,field.type());
+      return type;
+    }
+
+    const static TypeClass & get(const Type & = Type())
+    {
+      const static TypeClass & cref_ = create();
+      return cref_;
+    }
+};
+
+} // namespace datatype
+} // namespace hdf5
+
+#define H5CPP_COMPOUND_EXPAND(x) x
+
+#define H5CPP_COMPOUND_FIELD(T, field) \
+  ::hdf5::datatype::CompoundField{#field, offsetof(T, field), sizeof(T::field), \
+    &::hdf5::datatype::compound_field_type<std::remove_cv_t<decltype(T::field)>>},
+
+#define H5CPP_COMPOUND_FE_1(M, T, a) M(T, a)
+#define H5CPP_COMPOUND_FE_2(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_1(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_3(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_2(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_4(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_3(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_5(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_4(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_6(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_5(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_7(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_6(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_8(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_7(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_9(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_8(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_10(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_9(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_11(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_10(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_12(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_11(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_13(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_12(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_14(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_13(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_15(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_14(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_16(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_15(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_17(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_16(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_18(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_17(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_19(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_18(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_20(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_19(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_21(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_20(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_22(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_21(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_23(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_22(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_24(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_23(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_25(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_24(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_26(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_25(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_27(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_26(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_28(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_27(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_29(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_28(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_30(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_29(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_31(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_30(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_32(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_31(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_33(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_32(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_34(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_33(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_35(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_34(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_36(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_35(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_37(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_36(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_38(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_37(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_39(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_38(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_40(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_39(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_41(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_40(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_42(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_41(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_43(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_42(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_44(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_43(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_45(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_44(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_46(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_45(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_47(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_46(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_48(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_47(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_49(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_48(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_50(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_49(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_51(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_50(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_52(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_51(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_53(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_52(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_54(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_53(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_55(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_54(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_56(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_55(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_57(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_56(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_58(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_57(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_59(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_58(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_60(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_59(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_61(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_60(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_62(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_61(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_63(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_62(M, T, __VA_ARGS__))
+#define H5CPP_COMPOUND_FE_64(M, T, a, ...) M(T, a) H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_FE_63(M, T, __VA_ARGS__))
+
+#define H5CPP_COMPOUND_SELECT( \
+    _1, _2, _3, _4, _5, _6, _7, _8, \
+    _9, _10, _11, _12, _13, _14, _15, _16, \
+    _17, _18, _19, _20, _21, _22, _23, _24, \
+    _25, _26, _27, _28, _29, _30, _31, _32, \
+    _33, _34, _35, _36, _37, _38, _39, _40, \
+    _41, _42, _43, _44, _45, _46, _47, _48, \
+    _49, _50, _51, _52, _53, _54, _55, _56, \
+    _57, _58, _59, _60, _61, _62, _63, _64, \
+    NAME, ...) NAME
+
+#define H5CPP_COMPOUND_FOR_EACH(M, T, ...) \
+  H5CPP_COMPOUND_EXPAND(H5CPP_COMPOUND_SELECT(__VA_ARGS__, \
+      H5CPP_COMPOUND_FE_64, H5CPP_COMPOUND_FE_63, H5CPP_COMPOUND_FE_62, H5CPP_COMPOUND_FE_61, \
+      H5CPP_COMPOUND_FE_60, H5CPP_COMPOUND_FE_59, H5CPP_COMPOUND_FE_58, H5CPP_COMPOUND_FE_57, \
+      H5CPP_COMPOUND_FE_56, H5CPP_COMPOUND_FE_55, H5CPP_COMPOUND_FE_54, H5CPP_COMPOUND_FE_53, \
+      H5CPP_COMPOUND_FE_52, H5CPP_COMPOUND_FE_51, H5CPP_COMPOUND_FE_50, H5CPP_COMPOUND_FE_49, \
+      H5CPP_COMPOUND_FE_48, H5CPP_COMPOUND_FE_47, H5CPP_COMPOUND_FE_46, H5CPP_COMPOUND_FE_45, \
+      H5CPP_COMPOUND_FE_44, H5CPP_COMPOUND_FE_43, H5CPP_COMPOUND_FE_42, H5CPP_COMPOUND_FE_41, \
+      H5CPP_COMPOUND_FE_40, H5CPP_COMPOUND_FE_39, H5CPP_COMPOUND_FE_38, H5CPP_COMPOUND_FE_37, \
+      H5CPP_COMPOUND_FE_36, H5CPP_COMPOUND_FE_35, H5CPP_COMPOUND_FE_34, H5CPP_COMPOUND_FE_33, \
+      H5CPP_COMPOUND_FE_32, H5CPP_COMPOUND_FE_31, H5CPP_COMPOUND_FE_30, H5CPP_COMPOUND_FE_29, \
+      H5CPP_COMPOUND_FE_28, H5CPP_COMPOUND_FE_27, H5CPP_COMPOUND_FE_26, H5CPP_COMPOUND_FE_25, \
+      H5CPP_COMPOUND_FE_24, H5CPP_COMPOUND_FE_23, H5CPP_COMPOUND_FE_22, H5CPP_COMPOUND_FE_21, \
+      H5CPP_COMPOUND_FE_20, H5CPP_COMPOUND_FE_19, H5CPP_COMPOUND_FE_18, H5CPP_COMPOUND_FE_17, \
+      H5CPP_COMPOUND_FE_16, H5CPP_COMPOUND_FE_15, H5CPP_COMPOUND_FE_14, H5CPP_COMPOUND_FE_13, \
+      H5CPP_COMPOUND_FE_12, H5CPP_COMPOUND_FE_11, H5CPP_COMPOUND_FE_10, H5CPP_COMPOUND_FE_9, \
+      H5CPP_COMPOUND_FE_8, H5CPP_COMPOUND_FE_7, H5CPP_COMPOUND_FE_6, H5CPP_COMPOUND_FE_5, \
+      H5CPP_COMPOUND_FE_4, H5CPP_COMPOUND_FE_3, H5CPP_COMPOUND_FE_2, H5CPP_COMPOUND_FE_1)(M, T, __VA_ARGS__))
+
+//!
+//! \brief generate the TypeTrait of a compound type
+//!
+//! Expands to a specialization of hdf5::datatype::CompoundLayout listing
+//! the given fields and a hdf5::datatype::TypeTrait derived from
+//! hdf5::datatype::CompoundTypeTrait. Every field is stored under its C++
+//! name at its C++ offset. The macro must be used in the global namespace
+//! and supports up to 64 fields.
+//!
+//! \code
+//! struct Event { double energy; std::uint64_t timestamp; };
+//! H5CPP_COMPOUND(Event, energy, timestamp)
+//! \endcode
+//!
+#define H5CPP_COMPOUND(T, ...) \
+  namespace hdf5 { \
+  namespace datatype { \
+  template<> \
+  struct CompoundLayout<T> \
+  { \
+    static constexpr CompoundField fields[] = { \
+      H5CPP_COMPOUND_FOR_EACH(H5CPP_COMPOUND_FIELD, T, __VA_ARGS__) \
+    }; \
+  }; \
+  template<> \
+  class TypeTrait<T> : public CompoundTypeTrait<T> {}; \
+  } \
+  }
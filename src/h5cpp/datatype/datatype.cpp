@@ -152,5 +152,18 @@ bool operator!=(const Datatype &lhs, const Datatype &rhs) {
   return !operator==(lhs, rhs);
 }
 
+bool is_fixed_size(const Datatype &type) {
+  if (type.has_class(Class::VarLength))
+    return false;
+
+  // variable length strings are not reported as variable length types
+  htri_t result = H5Tis_variable_str(static_cast<hid_t>(type));
+  if (result < 0) {
+    error::Singleton::instance().throw_with_stack(
+        "Could not determine if type is a variable length string");
+  }
+  return result == 0;
+}
+
 } // namespace datatype
 } // namespace hdf5
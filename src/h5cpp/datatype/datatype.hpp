@@ -191,5 +191,20 @@ DLL_EXPORT bool operator==(const Datatype &lhs, const Datatype &rhs);
 //!
 DLL_EXPORT bool operator!=(const Datatype &lhs, const Datatype &rhs);
 
+//!
+//! @brief check if a type has a fixed size
+//!
+//! Returns false if the type is a variable length string or variable
+//! length sequence or if it contains such a type (for instance as a member
+//! of a compound type). Elements of a fixed size type are stored in the
+//! file exactly as described by the type and can thus be transferred as
+//! raw bytes.
+//!
+//! @throws std::runtime_error in case of a failure
+//! @param type reference to the datatype to check
+//! @return true if the type has a fixed size, false otherwise
+//!
+DLL_EXPORT bool is_fixed_size(const Datatype &type);
+
 } // namespace datatype
 } // namespace hdf5
@@ -0,0 +1,137 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#include <mutex>
+#include <h5cpp/datatype/type_cache.hpp>
+
+namespace hdf5 {
+namespace datatype {
+
+bool TypeCache::Key::operator==(const Key &other) const
+{
+  return type == other.type && variant == other.variant;
+}
+
+size_t TypeCache::KeyHash::operator()(const Key &key) const
+{
+  size_t hash = std::hash<std::type_index>()(key.type);
+  return hash ^ (std::hash<std::string>()(key.variant) + 0x9e3779b9 + (hash << 6) + (hash >> 2));
+}
+
+TypeCache &TypeCache::instance()
+{
+  static TypeCache cache;
+  return cache;
+}
+
+TypeCache::TypeCache():
+    mutex_(),
+    types_(),
+    hits_(0),
+    misses_(0)
+{}
+
+const String &TypeCache::variable_string(CharacterEncoding encoding)
+{
+  std::string variant = "variable:" + std::to_string(static_cast<int>(encoding));
+  const Datatype &type = get(std::type_index(typeid(String)),variant,
+                             [encoding]()
+                             {
+                               String type = String::variable();
+                               type.encoding(encoding);
+                               return Datatype(type);
+                             });
+  return static_cast<const String&>(type);
+}
+
+const String &TypeCache::fixed_string(size_t size,CharacterEncoding encoding,
+                                      StringPad padding)
+{
+  std::string variant = "fixed:" + std::to_string(size) + ":" +
+                        std::to_string(static_cast<int>(encoding)) + ":" +
+                        std::to_string(static_cast<int>(padding));
+  const Datatype &type = get(std::type_index(typeid(String)),variant,
+                             [size,encoding,padding]()
+                             {
+                               String type = String::fixed(size);
+                               type.encoding(encoding);
+                               type.padding(padding);
+                               return Datatype(type);
+                             });
+  return static_cast<const String&>(type);
+}
+
+const Datatype &TypeCache::get(const std::type_index &type,
+                               const std::string &variant,
+                               const Factory &factory)
+{
+  Key key{type,variant};
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto iter = types_.find(key);
+    if(iter != types_.end())
+    {
+      ++hits_;
+      return *iter->second;
+    }
+  }
+
+  ++misses_;
+  Datatype created = factory();
+  std::unique_ptr<Datatype> entry;
+  if(created.get_class() == Class::String)
+    entry.reset(new String(created));
+  else
+    entry.reset(new Datatype(created));
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  auto result = types_.emplace(std::move(key),std::move(entry));
+  return *result.first->second;
+}
+
+size_t TypeCache::hits() const noexcept
+{
+  return hits_;
+}
+
+size_t TypeCache::misses() const noexcept
+{
+  return misses_;
+}
+
+size_t TypeCache::size() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return types_.size();
+}
+
+void TypeCache::clear()
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  types_.clear();
+  hits_ = 0;
+  misses_ = 0;
+}
+
+} // namespace datatype
+} // namespace hdf5
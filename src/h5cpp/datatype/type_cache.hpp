@@ -0,0 +1,192 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <h5cpp/datatype/datatype.hpp>
+#include <h5cpp/datatype/string.hpp>
+#include <h5cpp/datatype/type_trait.hpp>
+#include <h5cpp/core/windows.hpp>
+
+namespace hdf5 {
+namespace datatype {
+
+//!
+//! \brief process-wide cache of memory datatypes
+//!
+//! Creating a datatype copies an HDF5 type and closing it releases the
+//! copy again. On hot IO paths this happens for every call unless the
+//! type is kept. The cache keeps one instance for every key and hands out
+//! references to it. A key consists of a C++ type and a variant string,
+//! which distinguishes types built for the same C++ type, for instance
+//! strings of different size, encoding and padding.
+//!
+//! All member functions are thread-safe. Lookups of existing types only
+//! take a shared lock. The numbers of hits and misses are counted.
+//!
+//! \code
+//! auto &cache = datatype::TypeCache::instance();
+//! const auto &type = cache.fixed_string(32,CharacterEncoding::UTF8);
+//! dataset.read(buffer,type,memory_space,file_space);
+//! \endcode
+//!
+//! References stay valid until clear() is called.
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+class DLL_EXPORT TypeCache
+{
+  public:
+    //!
+    //! \brief function creating a datatype on a cache miss
+    //!
+    using Factory = std::function<Datatype()>;
+
+    //!
+    //! \brief reference to the process-wide cache
+    //!
+    static TypeCache &instance();
+
+    TypeCache(const TypeCache &) = delete;
+    TypeCache &operator=(const TypeCache &) = delete;
+
+    //!
+    //! \brief get the datatype of a C++ type
+    //!
+    //! The type is created with TypeTrait<T>::create() on the first call.
+    //!
+    //! \tparam T the C++ type
+    //! \return reference to the cached datatype
+    //!
+    template<typename T>
+    const Datatype &get();
+
+    //!
+    //! \brief get a variable length string type
+    //!
+    //! \param encoding the character encoding
+    //! \return reference to the cached string type
+    //!
+    const String &variable_string(CharacterEncoding encoding = CharacterEncoding::ASCII);
+
+    //!
+    //! \brief get a fixed length string type
+    //!
+    //! \throws std::runtime_error if size is 0
+    //! \param size the number of characters
+    //! \param encoding the character encoding
+    //! \param padding the string padding
+    //! \return reference to the cached string type
+    //!
+    const String &fixed_string(size_t size,
+                               CharacterEncoding encoding = CharacterEncoding::ASCII,
+                               StringPad padding = StringPad::NullTerm);
+
+    //!
+    //! \brief get a datatype for an arbitrary key
+    //!
+    //! Calls factory only if there is no type for the key yet. The factory
+    //! is called without holding a lock. If two threads miss at the same
+    //! time, the type created first is kept.
+    //!
+    //! \param type the C++ type of the key
+    //! \param variant the variant of the key
+    //! \param factory function creating the type on a miss
+    //! \return reference to the cached datatype
+    //!
+    const Datatype &get(const std::type_index &type,const std::string &variant,
+                        const Factory &factory);
+
+    //!
+    //! \brief number of lookups which found a type
+    //!
+    size_t hits() const noexcept;
+
+    //!
+    //! \brief number of lookups which had to create a type
+    //!
+    size_t misses() const noexcept;
+
+    //!
+    //! \brief number of cached types
+    //!
+    size_t size() const;
+
+    //!
+    //! \brief remove all types and reset the counters
+    //!
+    //! Invalidates all references obtained from the cache. Must only be
+    //! called while no other thread uses the cache.
+    //!
+    void clear();
+
+  private:
+    TypeCache();
+
+    struct Key
+    {
+      std::type_index type;
+      std::string variant;
+
+      bool operator==(const Key &other) const;
+    };
+
+    struct KeyHash
+    {
+      size_t operator()(const Key &key) const;
+    };
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<Key,std::unique_ptr<Datatype>,KeyHash> types_;
+    std::atomic<size_t> hits_;
+    std::atomic<size_t> misses_;
+};
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+template<typename T>
+const Datatype &TypeCache::get()
+{
+  return get(std::type_index(typeid(T)),std::string(),
+             []() { return Datatype(TypeTrait<T>::create()); });
+}
+
+} // namespace datatype
+} // namespace hdf5
@@ -56,6 +56,16 @@ bool Singleton::auto_print() const
   return auto_print_;
 }
 
+void Singleton::lazy_stack(bool enable) noexcept
+{
+  lazy_stack_ = enable;
+}
+
+bool Singleton::lazy_stack() const noexcept
+{
+  return lazy_stack_;
+}
+
 H5CError Singleton::extract_stack()
 {
   std::list<Descriptor> ret;
@@ -77,7 +87,10 @@ void Singleton::throw_with_stack(const std::string& message)
   {
     try
     {
-      throw_stack();
+      if (lazy_stack_)
+        throw_stack_copy();
+      else
+        throw_stack();
     }
     catch(...)
     {
@@ -119,6 +132,20 @@ void Singleton::throw_stack()
 }
 
 
+void Singleton::throw_stack_copy()
+{
+  // H5Eget_current_stack also clears the current stack
+  hid_t stack = H5Eget_current_stack();
+  if (0 > stack)
+  {
+    throw std::runtime_error("Could not copy error stack");
+  }
+
+  H5CError error(stack);
+  if (!error.empty())
+    throw error;
+}
+
 void Singleton::clear_stack()
 {
   herr_t ret = H5Eclear2(error::kDefault);
@@ -24,6 +24,7 @@
 //
 #pragma once
 
+#include <atomic>
 #include <h5cpp/core/windows.hpp>
 #include <h5cpp/error/h5c_error.hpp>
 
@@ -78,6 +79,27 @@ class DLL_EXPORT Singleton
   //!
   bool auto_print() const;
 
+  //!
+  //! \brief toggle lazy decoding of the error stack
+  //!
+  //! If enabled, throw_with_stack() only takes a copy of the HDF5 error
+  //! stack with H5Eget_current_stack. The copy is decoded into descriptors
+  //! when what() or contents() of the nested H5CError is called, for
+  //! instance by print_nested(). Errors which are caught and discarded
+  //! then do not pay for walking the stack and looking up the messages.
+  //!
+  //! Lazy decoding is disabled by default unless the library was built
+  //! with H5CPP_LAZY_ERROR_STACK.
+  //!
+  //! \param enable true to enable lazy decoding, false otherwise
+  //!
+  void lazy_stack(bool enable) noexcept;
+
+  //!
+  //! \brief indicates if the error stack is decoded lazily
+  //!
+  bool lazy_stack() const noexcept;
+
   //!
   //! \brief returns most recent error stack as Stack
   //!
@@ -116,6 +138,11 @@ class DLL_EXPORT Singleton
   void operator=(Singleton const&) = delete;
 
   bool auto_print_ {true};
+#ifdef H5CPP_LAZY_ERROR_STACK
+  std::atomic<bool> lazy_stack_ {true};
+#else
+  std::atomic<bool> lazy_stack_ {false};
+#endif
 
  private:
   // Helper functions, used internally only
@@ -128,6 +155,9 @@ class DLL_EXPORT Singleton
   // extracts error stack and throws it as H5CError
   void throw_stack();
 
+  // copies the error stack and throws it as H5CError without decoding it
+  void throw_stack_copy();
+
   // functor for H5EWalk
   static herr_t to_list(unsigned n,
                         const H5E_error2_t *err_desc,
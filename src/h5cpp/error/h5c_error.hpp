@@ -28,6 +28,8 @@
 #include <sstream>
 #include <stdexcept>
 #include <list>
+#include <memory>
+#include <mutex>
 
 namespace hdf5 {
 namespace error {
@@ -40,9 +42,14 @@ namespace error {
 //! Descriptor objects. Upon construction, the object also generates
 //! a string containing the a printout of the H5CError.
 //!
+//! An H5CError constructed from a copy of the HDF5 error stack only decodes
+//! the stack when what() or contents() is called for the first time. This
+//! keeps errors which are caught and discarded cheap.
+//!
 #ifdef __clang__
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wweak-vtables"
+#pragma clang diagnostic ignored "-Wpadded"
 #endif
 class H5CError : public std::runtime_error
 {
@@ -57,6 +64,18 @@ class H5CError : public std::runtime_error
   //!
   H5CError(const std::list<Descriptor>& H5CError);
 
+  //!
+  //! \brief constructor
+  //!
+  //! Takes ownership of a copy of an HDF5 error stack as obtained from
+  //! H5Eget_current_stack. The stack is decoded on first access and closed
+  //! with the last copy of the exception. Should only be used internally by
+  //! the library.
+  //!
+  //! \param stack identifier of the error stack copy
+  //!
+  explicit H5CError(hid_t stack);
+
   //!
   //! \brief printout of error H5CError
   //!
@@ -80,8 +99,32 @@ class H5CError : public std::runtime_error
   bool empty() const;
 
  private:
-  std::list<Descriptor> contents_;
-  std::string what_message_;
+  //
+  // shared by all copies of an exception
+  //
+  struct Contents
+  {
+    explicit Contents(hid_t stack_id) : stack(stack_id) {}
+    Contents(const Contents &) = delete;
+    Contents &operator=(const Contents &) = delete;
+    ~Contents()
+    {
+      if (stack >= 0)
+        H5Eclose_stack(stack);
+    }
+
+    hid_t stack;
+    std::list<Descriptor> descriptors;
+    std::string what_message;
+    std::once_flag decoded;
+  };
+
+  std::shared_ptr<Contents> contents_;
+
+  void decode() const;
+
+  static herr_t to_list(unsigned n, const H5E_error2_t *err_desc,
+                        void *list);
 };
 #ifdef __clang__
 #pragma clang diagnostic pop
@@ -89,31 +132,69 @@ class H5CError : public std::runtime_error
 
 inline H5CError::H5CError(const std::list<Descriptor>& H5CError)
 : std::runtime_error("")
-, contents_(H5CError)
+, contents_(std::make_shared<Contents>(-1))
 {
-  std::stringstream ss;
-  for (auto& c : contents_)
-  {
-    c.extract_strings();
-    ss << c << "\n";
-  }
-  what_message_ = ss.str();
+  contents_->descriptors = H5CError;
+  decode();
 }
 
+inline H5CError::H5CError(hid_t stack)
+: std::runtime_error("")
+, contents_(std::make_shared<Contents>(stack))
+{}
+
+inline herr_t H5CError::to_list(unsigned n, const H5E_error2_t *err_desc,
+                                void *list)
+{
+  (void)n;
+  static_cast<std::list<Descriptor>*>(list)->push_back(Descriptor(*err_desc));
+  return 0;
+}
+
+inline void H5CError::decode() const
+{
+  Contents &contents = *contents_;
+  std::call_once(contents.decoded, [&contents]()
+  {
+    if (contents.stack >= 0 &&
+        H5Ewalk2(contents.stack, H5E_WALK_DOWNWARD, to_list,
+                 &contents.descriptors) < 0)
+      throw std::runtime_error("Could not decode error stack");
+
+    std::stringstream ss;
+    for (auto& c : contents.descriptors)
+    {
+      c.extract_strings();
+      ss << c << "\n";
+    }
+    contents.what_message = ss.str();
+  });
+}
 
 inline const char* H5CError::what() const noexcept
 {
-  return what_message_.c_str();
+  try
+  {
+    decode();
+  }
+  catch (...)
+  {
+    return "Could not decode error stack";
+  }
+  return contents_->what_message.c_str();
 }
 
 inline const std::list<Descriptor>& H5CError::contents() const
 {
-  return contents_;
+  decode();
+  return contents_->descriptors;
 }
 
 inline bool H5CError::empty() const
 {
-  return contents_.empty();
+  if (contents_->stack >= 0)
+    return H5Eget_num(contents_->stack) <= 0;
+  return contents_->descriptors.empty();
 }
 
 } // namespace file
@@ -51,7 +51,8 @@ enum class DriverID : unsigned
   Posix = 1,
   Direct = 2,
   Memory = 3,
-  MPI = 4
+  MPI = 4,
+  IoUring = 5
 };
 
 //!
@@ -0,0 +1,800 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#include <h5cpp/file/io_uring_driver.hpp>
+
+#ifdef H5CPP_WITH_IO_URING
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <h5cpp/core/hdf5_capi.hpp>
+#include <h5cpp/error/error.hpp>
+#include <h5cpp/property/file_access.hpp>
+
+namespace hdf5 {
+namespace file {
+
+namespace {
+
+//
+// driver configuration stored in the file access property list
+//
+struct Config
+{
+  unsigned queue_depth;
+  size_t block_size;
+  bool direct;
+  bool registered_buffers;
+};
+
+const Config default_config{16,1024*1024,false,false};
+
+//
+// largest address representable by off_t
+//
+const haddr_t max_address = (haddr_t(1) << (8 * sizeof(off_t) - 1)) - 1;
+
+//
+// io_uring instance set up with the raw system calls
+//
+struct Ring
+{
+  int fd;
+  unsigned entries;
+  void *sq_map;
+  size_t sq_map_size;
+  void *cq_map;
+  size_t cq_map_size;
+  unsigned *sq_head;
+  unsigned *sq_tail;
+  unsigned *sq_mask;
+  unsigned *sq_array;
+  unsigned *cq_head;
+  unsigned *cq_tail;
+  unsigned *cq_mask;
+  io_uring_sqe *sqes;
+  size_t sqes_size;
+  io_uring_cqe *cqes;
+};
+
+void ring_teardown(Ring &ring)
+{
+  if(ring.sqes)
+    munmap(ring.sqes,ring.sqes_size);
+  if(ring.cq_map && ring.cq_map != ring.sq_map)
+    munmap(ring.cq_map,ring.cq_map_size);
+  if(ring.sq_map)
+    munmap(ring.sq_map,ring.sq_map_size);
+  if(ring.fd >= 0)
+    close(ring.fd);
+
+  std::memset(&ring,0,sizeof(ring));
+  ring.fd = -1;
+}
+
+void *map_ring(int fd,size_t size,off_t offset)
+{
+  void *map = mmap(nullptr,size,PROT_READ|PROT_WRITE,MAP_SHARED|MAP_POPULATE,
+                   fd,offset);
+  return map == MAP_FAILED ? nullptr : map;
+}
+
+//
+// returns 0 on success and an errno value otherwise
+//
+int ring_setup(Ring &ring,unsigned entries)
+{
+  std::memset(&ring,0,sizeof(ring));
+  io_uring_params params;
+  std::memset(&params,0,sizeof(params));
+
+  ring.fd = static_cast<int>(syscall(__NR_io_uring_setup,entries,&params));
+  if(ring.fd < 0)
+    return errno;
+
+  ring.entries = params.sq_entries;
+  ring.sq_map_size = params.sq_off.array + params.sq_entries*sizeof(unsigned);
+  ring.cq_map_size = params.cq_off.cqes + params.cq_entries*sizeof(io_uring_cqe);
+  bool single_map = params.features & IORING_FEAT_SINGLE_MMAP;
+  if(single_map)
+    ring.sq_map_size = ring.cq_map_size = std::max(ring.sq_map_size,
+                                                   ring.cq_map_size);
+
+  ring.sq_map = map_ring(ring.fd,ring.sq_map_size,IORING_OFF_SQ_RING);
+  if(ring.sq_map && single_map)
+    ring.cq_map = ring.sq_map;
+  else if(ring.sq_map)
+    ring.cq_map = map_ring(ring.fd,ring.cq_map_size,IORING_OFF_CQ_RING);
+  ring.sqes_size = params.sq_entries*sizeof(io_uring_sqe);
+  if(ring.cq_map)
+    ring.sqes = static_cast<io_uring_sqe*>(map_ring(ring.fd,ring.sqes_size,
+                                                    IORING_OFF_SQES));
+  if(!ring.sqes)
+  {
+    int error = errno;
+    ring_teardown(ring);
+    return error;
+  }
+
+  char *sq = static_cast<char*>(ring.sq_map);
+  ring.sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+  ring.sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+  ring.sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+  ring.sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+  char *cq = static_cast<char*>(ring.cq_map);
+  ring.cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+  ring.cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+  ring.cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+  ring.cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+  return 0;
+}
+
+//
+// an open file, libhdf5 only knows about the leading H5FD_t
+//
+struct UringFile
+{
+  H5FD_t pub;
+  int fd;
+  haddr_t eoa;
+  haddr_t eof;
+  dev_t device;
+  ino_t inode;
+  Config config;
+  Ring ring;
+  char *buffers;
+};
+
+UringFile *to_file(H5FD_t *file)
+{
+  return reinterpret_cast<UringFile*>(file);
+}
+
+const UringFile *to_file(const H5FD_t *file)
+{
+  return reinterpret_cast<const UringFile*>(file);
+}
+
+//
+// a contiguous part of a transfer handled by a single queue entry
+//
+struct Segment
+{
+  off_t offset;
+  char *data;
+  size_t size;
+  size_t done;
+  unsigned slot;
+};
+
+void push_error(hid_t major,hid_t minor,const std::string &message)
+{
+  H5Epush2(H5E_DEFAULT,__FILE__,"IoUringDriver",__LINE__,H5E_ERR_CLS,
+           major,minor,"%s",message.c_str());
+}
+
+//
+// submits all segments and waits for their completion, incomplete
+// transfers are resubmitted and reads beyond the end of the file are
+// filled with zeros
+//
+// returns 0 on success and an errno value otherwise
+//
+int submit(UringFile &file,bool write,std::vector<Segment> &segments)
+{
+  Ring &ring = file.ring;
+  bool fixed = file.config.registered_buffers;
+  unsigned char opcode = write ? (fixed ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE)
+                               : (fixed ? IORING_OP_READ_FIXED : IORING_OP_READ);
+
+  std::vector<size_t> pending(segments.size());
+  for(size_t index = 0; index < pending.size(); ++index)
+    pending[index] = index;
+
+  int error = 0;
+  while(!pending.empty() && !error)
+  {
+    unsigned tail = *ring.sq_tail;
+    for(size_t index: pending)
+    {
+      Segment &segment = segments[index];
+      unsigned entry = tail & *ring.sq_mask;
+      io_uring_sqe &sqe = ring.sqes[entry];
+      std::memset(&sqe,0,sizeof(sqe));
+      sqe.opcode = opcode;
+      sqe.fd = file.fd;
+      sqe.off = static_cast<__u64>(segment.offset) + segment.done;
+      sqe.addr = reinterpret_cast<__u64>(segment.data + segment.done);
+      sqe.len = static_cast<__u32>(segment.size - segment.done);
+      if(fixed)
+        sqe.buf_index = static_cast<__u16>(segment.slot);
+      sqe.user_data = index;
+      ring.sq_array[entry] = entry;
+      ++tail;
+    }
+    __atomic_store_n(ring.sq_tail,tail,__ATOMIC_RELEASE);
+
+    size_t submitted = pending.size();
+    size_t completed = 0;
+    pending.clear();
+    while(completed < submitted)
+    {
+      unsigned to_submit = tail - __atomic_load_n(ring.sq_head,__ATOMIC_ACQUIRE);
+      if(syscall(__NR_io_uring_enter,ring.fd,to_submit,1,
+                 IORING_ENTER_GETEVENTS,nullptr,0) < 0 &&
+         errno != EINTR && errno != EAGAIN && errno != EBUSY)
+        return errno;
+
+      unsigned head = *ring.cq_head;
+      unsigned cq_tail = __atomic_load_n(ring.cq_tail,__ATOMIC_ACQUIRE);
+      for(; head != cq_tail; ++head, ++completed)
+      {
+        const io_uring_cqe &cqe = ring.cqes[head & *ring.cq_mask];
+        size_t index = static_cast<size_t>(cqe.user_data);
+        Segment &segment = segments[index];
+        size_t remaining = segment.size - segment.done;
+
+        if(cqe.res == -EINTR || cqe.res == -EAGAIN)
+          pending.push_back(index);
+        else if(cqe.res < 0)
+          error = -cqe.res;
+        else if(write && cqe.res == 0)
+          error = EIO;
+        else if(!write && (cqe.res == 0 ||
+                (file.config.direct && static_cast<size_t>(cqe.res) < remaining)))
+        {
+          // end of file, O_DIRECT cannot resume at an unaligned offset
+          segment.done += static_cast<size_t>(cqe.res);
+          std::memset(segment.data + segment.done,0,segment.size - segment.done);
+          segment.done = segment.size;
+        }
+        else
+        {
+          segment.done += static_cast<size_t>(cqe.res);
+          if(segment.done < segment.size)
+            pending.push_back(index);
+        }
+      }
+      __atomic_store_n(ring.cq_head,head,__ATOMIC_RELEASE);
+    }
+  }
+  return error;
+}
+
+void copy_out(const Segment &segment,haddr_t addr,size_t size,char *data)
+{
+  haddr_t begin = std::max<haddr_t>(static_cast<haddr_t>(segment.offset),addr);
+  haddr_t end = std::min<haddr_t>(segment.offset + segment.size,addr + size);
+  std::memcpy(data + (begin - addr),segment.data + (begin - segment.offset),
+              end - begin);
+}
+
+void copy_in(Segment &segment,haddr_t addr,size_t size,const char *data)
+{
+  haddr_t begin = std::max<haddr_t>(static_cast<haddr_t>(segment.offset),addr);
+  haddr_t end = std::min<haddr_t>(segment.offset + segment.size,addr + size);
+  std::memcpy(segment.data + (begin - segment.offset),data + (begin - addr),
+              end - begin);
+}
+
+//
+// performs a read or write of arbitrary size and alignment in batches of
+// at most queue_depth blocks
+//
+// returns 0 on success and an errno value otherwise
+//
+int transfer(UringFile &file,bool write,haddr_t addr,size_t size,char *data)
+{
+  const Config &config = file.config;
+  bool bounce = file.buffers != nullptr;
+  haddr_t begin = addr;
+  haddr_t end = addr + size;
+  if(config.direct)
+  {
+    begin = begin / IoUringDriver::alignment * IoUringDriver::alignment;
+    end = (end + IoUringDriver::alignment - 1) / IoUringDriver::alignment *
+          IoUringDriver::alignment;
+  }
+
+  std::vector<Segment> segments;
+  std::vector<Segment> partial;
+  segments.reserve(config.queue_depth);
+  for(haddr_t start = begin; start < end;)
+  {
+    segments.clear();
+    for(unsigned slot = 0; slot < config.queue_depth && start < end; ++slot)
+    {
+      size_t length = static_cast<size_t>(std::min<haddr_t>(config.block_size,
+                                                            end - start));
+      char *target = bounce ? file.buffers + size_t(slot) * config.block_size
+                            : data + (start - addr);
+      segments.push_back(Segment{static_cast<off_t>(start),target,length,0,slot});
+      start += length;
+    }
+
+    if(bounce && write)
+    {
+      // blocks not entirely covered by the caller's data are read first
+      partial.clear();
+      for(const auto &segment: segments)
+        if(static_cast<haddr_t>(segment.offset) < addr ||
+           segment.offset + segment.size > addr + size)
+          partial.push_back(segment);
+      if(!partial.empty())
+        if(int error = submit(file,false,partial))
+          return error;
+
+      for(auto &segment: segments)
+        copy_in(segment,addr,size,data);
+    }
+
+    if(int error = submit(file,write,segments))
+      return error;
+
+    if(bounce && !write)
+      for(const auto &segment: segments)
+        copy_out(segment,addr,size,data);
+
+    if(write)
+      file.eof = std::max<haddr_t>(file.eof,segments.back().offset +
+                                            segments.back().size);
+  }
+  return 0;
+}
+
+void *fapl_copy(const void *fapl)
+{
+  return new Config(*static_cast<const Config*>(fapl));
+}
+
+herr_t fapl_free(void *fapl)
+{
+  delete static_cast<Config*>(fapl);
+  return 0;
+}
+
+void *fapl_get(H5FD_t *file)
+{
+  return new Config(to_file(file)->config);
+}
+
+void close_file(UringFile *file)
+{
+  ring_teardown(file->ring);
+  std::free(file->buffers);
+  close(file->fd);
+  delete file;
+}
+
+H5FD_t *open_file(const char *name,unsigned flags,hid_t fapl,haddr_t maxaddr)
+{
+  if(!name || !*name)
+  {
+    push_error(H5E_ARGS,H5E_BADVALUE,"invalid file name");
+    return nullptr;
+  }
+  if(maxaddr == 0 || maxaddr == HADDR_UNDEF || maxaddr > max_address)
+  {
+    push_error(H5E_ARGS,H5E_BADRANGE,"bogus maximum address");
+    return nullptr;
+  }
+
+  auto info = static_cast<const Config*>(H5Pget_driver_info(fapl));
+  Config config = info ? *info : default_config;
+
+  int open_flags = (flags & H5F_ACC_RDWR) ? O_RDWR : O_RDONLY;
+  if(flags & H5F_ACC_TRUNC)
+    open_flags |= O_TRUNC;
+  if(flags & H5F_ACC_CREAT)
+    open_flags |= O_CREAT;
+  if(flags & H5F_ACC_EXCL)
+    open_flags |= O_EXCL;
+  if(config.direct)
+    open_flags |= O_DIRECT;
+
+  int fd = open(name,open_flags,0666);
+  if(fd < 0)
+  {
+    push_error(H5E_FILE,H5E_CANTOPENFILE,std::string("unable to open file ")+
+               name+": "+std::strerror(errno));
+    return nullptr;
+  }
+
+  struct stat status;
+  if(fstat(fd,&status) < 0)
+  {
+    push_error(H5E_FILE,H5E_BADFILE,std::string("unable to stat file ")+name);
+    close(fd);
+    return nullptr;
+  }
+
+  auto file = new UringFile();
+  file->fd = fd;
+  file->eof = static_cast<haddr_t>(status.st_size);
+  file->device = status.st_dev;
+  file->inode = status.st_ino;
+  file->config = config;
+
+  if(int error = ring_setup(file->ring,config.queue_depth))
+  {
+    push_error(H5E_VFL,H5E_CANTINIT,std::string("unable to set up io_uring: ")+
+               std::strerror(error));
+    file->ring.fd = -1;
+    close_file(file);
+    return nullptr;
+  }
+
+  if(config.direct || config.registered_buffers)
+  {
+    void *buffers = nullptr;
+    size_t size = size_t(config.queue_depth) * config.block_size;
+    if(posix_memalign(&buffers,IoUringDriver::alignment,size) != 0)
+    {
+      push_error(H5E_RESOURCE,H5E_CANTALLOC,"unable to allocate I/O buffers");
+      close_file(file);
+      return nullptr;
+    }
+    file->buffers = static_cast<char*>(buffers);
+  }
+
+  if(config.registered_buffers)
+  {
+    std::vector<iovec> vectors(config.queue_depth);
+    for(size_t slot = 0; slot < vectors.size(); ++slot)
+    {
+      vectors[slot].iov_base = file->buffers + slot * config.block_size;
+      vectors[slot].iov_len = config.block_size;
+    }
+    if(syscall(__NR_io_uring_register,file->ring.fd,IORING_REGISTER_BUFFERS,
+               vectors.data(),config.queue_depth) < 0)
+    {
+      push_error(H5E_VFL,H5E_CANTINIT,std::string("unable to register buffers: ")+
+                 std::strerror(errno));
+      close_file(file);
+      return nullptr;
+    }
+  }
+
+  return &file->pub;
+}
+
+herr_t close_driver_file(H5FD_t *file)
+{
+  close_file(to_file(file));
+  return 0;
+}
+
+int compare_files(const H5FD_t *first,const H5FD_t *second)
+{
+  const UringFile *a = to_file(first);
+  const UringFile *b = to_file(second);
+  if(a->device != b->device)
+    return a->device < b->device ? -1 : 1;
+  if(a->inode != b->inode)
+    return a->inode < b->inode ? -1 : 1;
+  return 0;
+}
+
+herr_t query_features(const H5FD_t *,unsigned long *flags)
+{
+  if(flags)
+  {
+    *flags = H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA |
+             H5FD_FEAT_DATA_SIEVE | H5FD_FEAT_AGGREGATE_SMALLDATA |
+             H5FD_FEAT_POSIX_COMPAT_HANDLE;
+#ifdef H5FD_FEAT_DEFAULT_VFD_COMPATIBLE
+    *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE;
+#endif
+  }
+  return 0;
+}
+
+haddr_t get_eoa(const H5FD_t *file,H5FD_mem_t)
+{
+  return to_file(file)->eoa;
+}
+
+herr_t set_eoa(H5FD_t *file,H5FD_mem_t,haddr_t addr)
+{
+  to_file(file)->eoa = addr;
+  return 0;
+}
+
+haddr_t get_eof(const H5FD_t *file,H5FD_mem_t)
+{
+  return to_file(file)->eof;
+}
+
+herr_t get_handle(H5FD_t *file,hid_t,void **handle)
+{
+  if(!handle)
+  {
+    push_error(H5E_ARGS,H5E_BADVALUE,"file handle not valid");
+    return -1;
+  }
+  *handle = &to_file(file)->fd;
+  return 0;
+}
+
+bool check_region(const UringFile &file,haddr_t addr,size_t size)
+{
+  if(addr == HADDR_UNDEF || addr > max_address || size > max_address - addr ||
+     addr + size > file.eoa)
+  {
+    std::stringstream ss;
+    ss<<"addressed region "<<addr<<"+"<<size<<" beyond the end of the "
+      <<"allocated space "<<file.eoa;
+    push_error(H5E_ARGS,H5E_OVERFLOW,ss.str());
+    return false;
+  }
+  return true;
+}
+
+herr_t read_file(H5FD_t *file,H5FD_mem_t,hid_t,haddr_t addr,size_t size,
+            void *buffer)
+{
+  UringFile &file_data = *to_file(file);
+  if(!check_region(file_data,addr,size))
+    return -1;
+
+  if(int error = transfer(file_data,false,addr,size,static_cast<char*>(buffer)))
+  {
+    push_error(H5E_IO,H5E_READERROR,std::string("file read failed: ")+
+               std::strerror(error));
+    return -1;
+  }
+  return 0;
+}
+
+herr_t write_file(H5FD_t *file,H5FD_mem_t,hid_t,haddr_t addr,size_t size,
+             const void *buffer)
+{
+  UringFile &file_data = *to_file(file);
+  if(!check_region(file_data,addr,size))
+    return -1;
+
+  // the buffer is only read by write operations
+  char *data = const_cast<char*>(static_cast<const char*>(buffer));
+  if(int error = transfer(file_data,true,addr,size,data))
+  {
+    push_error(H5E_IO,H5E_WRITEERROR,std::string("file write failed: ")+
+               std::strerror(error));
+    return -1;
+  }
+  return 0;
+}
+
+herr_t truncate_file(H5FD_t *file,hid_t,hbool_t)
+{
+  UringFile &file_data = *to_file(file);
+  if(file_data.eoa == file_data.eof)
+    return 0;
+
+  if(ftruncate(file_data.fd,static_cast<off_t>(file_data.eoa)) < 0)
+  {
+    push_error(H5E_IO,H5E_SEEKERROR,std::string("unable to truncate file: ")+
+               std::strerror(errno));
+    return -1;
+  }
+  file_data.eof = file_data.eoa;
+  return 0;
+}
+
+herr_t lock_file(H5FD_t *file,hbool_t read_write)
+{
+  int operation = (read_write ? LOCK_EX : LOCK_SH) | LOCK_NB;
+  if(flock(to_file(file)->fd,operation) < 0 && errno != ENOSYS)
+  {
+    push_error(H5E_FILE,H5E_BADFILE,std::string("unable to lock the file: ")+
+               std::strerror(errno));
+    return -1;
+  }
+  return 0;
+}
+
+herr_t unlock_file(H5FD_t *file)
+{
+  if(flock(to_file(file)->fd,LOCK_UN) < 0 && errno != ENOSYS)
+  {
+    push_error(H5E_FILE,H5E_BADFILE,std::string("unable to unlock the file: ")+
+               std::strerror(errno));
+    return -1;
+  }
+  return 0;
+}
+
+//
+// the fields of H5FD_class_t differ between library versions, only the
+// ones common to all of them are set
+//
+H5FD_class_t make_class()
+{
+  H5FD_class_t cls;
+  std::memset(&cls,0,sizeof(cls));
+#if H5_VERSION_GE(1,13,2)
+  cls.version = H5FD_CLASS_VERSION;
+  cls.value = static_cast<H5FD_class_value_t>(520);
+#endif
+  cls.name = "io_uring";
+  cls.maxaddr = max_address;
+  cls.fc_degree = H5F_CLOSE_WEAK;
+  cls.fapl_size = sizeof(Config);
+  cls.fapl_get = fapl_get;
+  cls.fapl_copy = fapl_copy;
+  cls.fapl_free = fapl_free;
+  cls.open = open_file;
+  cls.close = close_driver_file;
+  cls.cmp = compare_files;
+  cls.query = query_features;
+  cls.get_eoa = get_eoa;
+  cls.set_eoa = set_eoa;
+  cls.get_eof = get_eof;
+  cls.get_handle = get_handle;
+  cls.read = read_file;
+  cls.write = write_file;
+  cls.truncate = truncate_file;
+  cls.lock = lock_file;
+  cls.unlock = unlock_file;
+
+  const H5FD_mem_t free_list_map[H5FD_MEM_NTYPES] = H5FD_FLMAP_DICHOTOMY;
+  std::copy(free_list_map,free_list_map + H5FD_MEM_NTYPES,cls.fl_map);
+  return cls;
+}
+
+//
+// the driver is registered on first use and again after the library
+// has been closed
+//
+hid_t driver_id()
+{
+  static std::mutex mutex;
+  static hid_t id = -1;
+  static const H5FD_class_t driver_class = make_class();
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if(id >= 0 && H5Iis_valid(id) > 0)
+    return id;
+
+  id = H5FDregister(&driver_class);
+  if(id < 0)
+  {
+    error::Singleton::instance().throw_with_stack(
+        "Failure registering the io_uring file driver!");
+  }
+  return id;
+}
+
+} // anonymous namespace
+
+IoUringDriver::IoUringDriver():
+    queue_depth_(default_config.queue_depth),
+    block_size_(default_config.block_size),
+    direct_(default_config.direct),
+    registered_buffers_(default_config.registered_buffers)
+{}
+
+IoUringDriver::IoUringDriver(unsigned queue_depth,size_t block_size,
+                             bool direct,bool registered_buffers):
+    IoUringDriver()
+{
+  this->queue_depth(queue_depth);
+  check_block_size(block_size,direct);
+  block_size_ = block_size;
+  direct_ = direct;
+  registered_buffers_ = registered_buffers;
+}
+
+unsigned IoUringDriver::queue_depth() const noexcept
+{
+  return queue_depth_;
+}
+
+void IoUringDriver::queue_depth(unsigned value)
+{
+  if(value == 0 || value > 4096)
+  {
+    std::stringstream ss;
+    ss<<"Invalid io_uring queue depth "<<value<<", must be within [1,4096]!";
+    throw std::runtime_error(ss.str());
+  }
+  queue_depth_ = value;
+}
+
+size_t IoUringDriver::block_size() const noexcept
+{
+  return block_size_;
+}
+
+void IoUringDriver::block_size(size_t value)
+{
+  check_block_size(value,direct_);
+  block_size_ = value;
+}
+
+bool IoUringDriver::direct() const noexcept
+{
+  return direct_;
+}
+
+void IoUringDriver::direct(bool value)
+{
+  check_block_size(block_size_,value);
+  direct_ = value;
+}
+
+bool IoUringDriver::registered_buffers() const noexcept
+{
+  return registered_buffers_;
+}
+
+void IoUringDriver::registered_buffers(bool value) noexcept
+{
+  registered_buffers_ = value;
+}
+
+void IoUringDriver::check_block_size(size_t value,bool direct) const
+{
+  if(value == 0 || (direct && value % alignment))
+  {
+    std::stringstream ss;
+    ss<<"Invalid io_uring block size "<<value<<"!";
+    if(direct)
+      ss<<" With O_DIRECT it must be a multiple of "<<alignment<<".";
+    throw std::runtime_error(ss.str());
+  }
+}
+
+void IoUringDriver::operator()(const property::FileAccessList &fapl) const
+{
+  Config config{queue_depth_,block_size_,direct_,registered_buffers_};
+  if(H5Pset_driver(static_cast<hid_t>(fapl),driver_id(),&config) < 0)
+  {
+    error::Singleton::instance().throw_with_stack("Failure setting io_uring driver!");
+  }
+}
+
+DriverID IoUringDriver::id() const noexcept
+{
+  return DriverID::IoUring;
+}
+
+} // namespace file
+} // namespace hdf5
+
+#endif
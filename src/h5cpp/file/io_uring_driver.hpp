@@ -0,0 +1,169 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <cstddef>
+#include <h5cpp/file/driver.hpp>
+
+namespace hdf5 {
+namespace file {
+
+#if ( defined(_DOXYGEN_) || defined(H5CPP_WITH_IO_URING) )
+
+//!
+//! \brief file driver using Linux io_uring (*for builds with H5CPP_WITH_IO_URING*)
+//!
+//! Registers a virtual file driver with libhdf5 which performs all reads
+//! and writes through an io_uring instance owned by each open file. A
+//! request is split into blocks of block_size() bytes and up to
+//! queue_depth() blocks are submitted with a single system call, so
+//! that large raw data transfers keep several requests in flight on the
+//! device.
+//!
+//! With direct() the file is opened with O_DIRECT and data is moved
+//! through a set of aligned buffers, one per queue entry. The driver
+//! rounds all transfers to multiples of alignment and performs the
+//! required read-modify-write cycles itself. With registered_buffers()
+//! these buffers are registered with the kernel and fixed buffer
+//! operations are used. Without either option the data is transferred
+//! directly from and to the caller's memory.
+//!
+//! Files written by this driver use the standard file format and can be
+//! read with every other driver.
+//!
+//! \code
+//! property::FileAccessList fapl;
+//! fapl.driver(file::IoUringDriver(32,1024*1024));
+//! auto f = file::open("detector.h5",file::AccessFlags::ReadOnly,fapl);
+//! \endcode
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+class DLL_EXPORT IoUringDriver : public Driver
+{
+  public:
+    //!
+    //! \brief alignment of O_DIRECT transfers in bytes
+    //!
+    static constexpr size_t alignment = 4096;
+
+    //!
+    //! \brief default constructor
+    //!
+    //! Uses a queue depth of 16 and a block size of 1 MiB without O_DIRECT
+    //! and registered buffers.
+    //!
+    IoUringDriver();
+
+    //!
+    //! \brief constructor
+    //!
+    //! \throws std::runtime_error if one of the parameters is invalid
+    //! \param queue_depth number of blocks submitted at once
+    //! \param block_size size of a single block in bytes
+    //! \param direct open files with O_DIRECT
+    //! \param registered_buffers use buffers registered with the kernel
+    //!
+    IoUringDriver(unsigned queue_depth,size_t block_size,bool direct = false,
+                  bool registered_buffers = false);
+
+    //!
+    //! \brief copy constructor
+    //!
+    IoUringDriver(const IoUringDriver &) = default;
+
+    //!
+    //! \brief get the queue depth
+    //!
+    unsigned queue_depth() const noexcept;
+
+    //!
+    //! \brief set the queue depth
+    //!
+    //! \throws std::runtime_error if the value is 0 or larger than 4096
+    //! \param value the number of blocks submitted at once
+    //!
+    void queue_depth(unsigned value);
+
+    //!
+    //! \brief get the block size
+    //!
+    size_t block_size() const noexcept;
+
+    //!
+    //! \brief set the block size
+    //!
+    //! \throws std::runtime_error if the value is 0 or, with direct(), not a
+    //!                            multiple of alignment
+    //! \param value the block size in bytes
+    //!
+    void block_size(size_t value);
+
+    //!
+    //! \brief true if files are opened with O_DIRECT
+    //!
+    bool direct() const noexcept;
+
+    //!
+    //! \brief enable or disable O_DIRECT
+    //!
+    //! \throws std::runtime_error if the block size is not a multiple of
+    //!                            alignment
+    //! \param value true to bypass the page cache
+    //!
+    void direct(bool value);
+
+    //!
+    //! \brief true if buffers registered with the kernel are used
+    //!
+    bool registered_buffers() const noexcept;
+
+    //!
+    //! \brief enable or disable registered buffers
+    //!
+    //! \param value true to use fixed buffer operations
+    //!
+    void registered_buffers(bool value) noexcept;
+
+    virtual void operator()(const property::FileAccessList &fapl) const override;
+    virtual DriverID id() const noexcept override;
+
+  private:
+    unsigned queue_depth_;
+    size_t block_size_;
+    bool direct_;
+    bool registered_buffers_;
+
+    void check_block_size(size_t value,bool direct) const;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+#endif
+
+} // namespace file
+} // namespace hdf5
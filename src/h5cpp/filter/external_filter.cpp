@@ -92,6 +92,7 @@ const std::vector<Availability> ExternalFilters::fill(const property::DatasetCre
   for(unsigned int nf=0; nf != nfilters; nf++)
   {
     std::vector<unsigned int> cd_values(max_cd_number);
+    cd_number = max_cd_number;
     int filter_id = H5Pget_filter(static_cast<hid_t>(dcpl),
 			      nf,
 			      &flag,
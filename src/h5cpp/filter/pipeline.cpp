@@ -0,0 +1,296 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <zlib.h>
+#include <h5cpp/filter/pipeline.hpp>
+
+namespace hdf5 {
+namespace filter {
+
+namespace {
+
+//
+// checksum algorithm identical to the one used by libhdf5
+//
+std::uint32_t fletcher32(const unsigned char *data,size_t size)
+{
+  size_t words = size / 2;
+  std::uint32_t sum1 = 0, sum2 = 0;
+
+  while(words)
+  {
+    size_t block = words > 360 ? 360 : words;
+    words -= block;
+    do
+    {
+      sum1 += static_cast<std::uint32_t>((data[0] << 8) | data[1]);
+      data += 2;
+      sum2 += sum1;
+    } while(--block);
+    sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+    sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+  }
+
+  if(size % 2)
+  {
+    sum1 += static_cast<std::uint32_t>(*data << 8);
+    sum2 += sum1;
+    sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+    sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+  }
+
+  sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+  sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+
+  return (sum2 << 16) | sum1;
+}
+
+void encode_fletcher32(FilterPipeline::Buffer &buffer)
+{
+  std::uint32_t checksum = fletcher32(buffer.data(),buffer.size());
+  // the checksum is stored in little endian byte order
+  for(size_t index = 0; index < 4; ++index)
+    buffer.push_back(static_cast<unsigned char>((checksum >> (8 * index)) & 0xff));
+}
+
+void decode_fletcher32(FilterPipeline::Buffer &buffer)
+{
+  if(buffer.size() < 4)
+    throw std::runtime_error("Chunk is too small to carry a Fletcher32 checksum!");
+
+  size_t size = buffer.size() - 4;
+  std::uint32_t stored = 0;
+  for(size_t index = 0; index < 4; ++index)
+    stored |= static_cast<std::uint32_t>(buffer[size + index]) << (8 * index);
+
+  std::uint32_t checksum = fletcher32(buffer.data(),size);
+  // files written by libhdf5 1.6.0 to 1.6.2 store the checksum with
+  // swapped bytes - libhdf5 accepts both
+  std::uint32_t reversed = (((checksum >> 8) & 0xff) << 24) |
+                           ((checksum & 0xff) << 16) |
+                           ((checksum >> 24) << 8) |
+                           ((checksum >> 16) & 0xff);
+  if(stored != checksum && stored != reversed)
+    throw std::runtime_error("Fletcher32 checksum mismatch - chunk data is corrupted!");
+
+  buffer.resize(size);
+}
+
+void shuffle(FilterPipeline::Buffer &buffer,size_t element_size,bool forward)
+{
+  size_t nelements = buffer.size() / element_size;
+  if(element_size <= 1 || nelements <= 1)
+    return;
+
+  FilterPipeline::Buffer result(buffer.size());
+  const unsigned char *source = buffer.data();
+  unsigned char *target = result.data();
+  for(size_t byte = 0; byte < element_size; ++byte)
+  {
+    for(size_t element = 0; element < nelements; ++element)
+    {
+      if(forward)
+        target[byte * nelements + element] = source[element * element_size + byte];
+      else
+        target[element * element_size + byte] = source[byte * nelements + element];
+    }
+  }
+  // trailing bytes which do not form a complete element remain in place
+  size_t tail = nelements * element_size;
+  std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(tail),buffer.end(),
+            result.begin() + static_cast<std::ptrdiff_t>(tail));
+  buffer.swap(result);
+}
+
+void deflate(FilterPipeline::Buffer &buffer,unsigned int level)
+{
+  uLongf size = compressBound(static_cast<uLong>(buffer.size()));
+  FilterPipeline::Buffer result(size);
+  int status = compress2(result.data(),&size,buffer.data(),
+                         static_cast<uLong>(buffer.size()),
+                         static_cast<int>(level));
+  if(status != Z_OK)
+  {
+    std::stringstream ss;
+    ss<<"Deflate compression of chunk failed with zlib error "<<status<<"!";
+    throw std::runtime_error(ss.str());
+  }
+  result.resize(size);
+  buffer.swap(result);
+}
+
+void inflate(FilterPipeline::Buffer &buffer,size_t size_hint)
+{
+  FilterPipeline::Buffer result(size_hint ? size_hint : 2 * buffer.size() + 64);
+
+  z_stream stream{};
+  stream.next_in = buffer.data();
+  stream.avail_in = static_cast<uInt>(buffer.size());
+  if(inflateInit(&stream) != Z_OK)
+    throw std::runtime_error("Cannot initialize zlib stream for chunk decompression!");
+
+  int status = Z_OK;
+  while(status != Z_STREAM_END)
+  {
+    if(stream.total_out == result.size())
+      result.resize(2 * result.size());
+
+    stream.next_out = result.data() + stream.total_out;
+    stream.avail_out = static_cast<uInt>(result.size() - stream.total_out);
+    status = ::inflate(&stream,Z_NO_FLUSH);
+    if(status != Z_OK && status != Z_STREAM_END)
+    {
+      inflateEnd(&stream);
+      std::stringstream ss;
+      ss<<"Deflate decompression of chunk failed with zlib error "<<status<<"!";
+      throw std::runtime_error(ss.str());
+    }
+  }
+  result.resize(stream.total_out);
+  inflateEnd(&stream);
+  buffer.swap(result);
+}
+
+} // anonymous namespace
+
+FilterPipeline::FilterPipeline(const property::DatasetCreationList &dcpl,
+                               size_t element_size):
+    stages_()
+{
+  ExternalFilters filters;
+  auto flags = filters.fill(dcpl);
+  for(size_t index = 0; index < filters.size(); ++index)
+    append(filters[index],flags[index],element_size);
+}
+
+FilterPipeline::FilterPipeline(const ExternalFilters &filters,
+                               size_t element_size):
+    stages_()
+{
+  for(const auto &filter: filters)
+    append(filter,Availability::Mandatory,element_size);
+}
+
+void FilterPipeline::append(const ExternalFilter &filter,Availability flag,
+                            size_t element_size)
+{
+  Stage stage{filter.id(),0,false};
+  switch(filter.id())
+  {
+    case H5Z_FILTER_DEFLATE:
+      stage.parameter = filter.cd_values().empty() ? 6 : filter.cd_values()[0];
+      break;
+    case H5Z_FILTER_SHUFFLE:
+      // libhdf5 stores the element size when the dataset is created
+      stage.parameter = filter.cd_values().empty() ?
+                        static_cast<unsigned int>(element_size) :
+                        filter.cd_values()[0];
+      break;
+    case H5Z_FILTER_FLETCHER32:
+      break;
+    default:
+      if(flag == Availability::Optional)
+      {
+        stage.skip = true;
+        break;
+      }
+      std::stringstream ss;
+      ss<<"Filter ["<<filter.id()<<"] "<<filter.name()
+        <<" cannot be applied outside of libhdf5!";
+      throw std::runtime_error(ss.str());
+  }
+  stages_.push_back(stage);
+}
+
+size_t FilterPipeline::size() const noexcept
+{
+  return stages_.size();
+}
+
+bool FilterPipeline::empty() const noexcept
+{
+  return stages_.empty();
+}
+
+std::uint32_t FilterPipeline::encode(Buffer &buffer) const
+{
+  std::uint32_t filter_mask = 0;
+  for(size_t index = 0; index < stages_.size(); ++index)
+  {
+    const Stage &stage = stages_[index];
+    if(stage.skip)
+    {
+      filter_mask |= 1u << index;
+      continue;
+    }
+
+    switch(stage.id)
+    {
+      case H5Z_FILTER_DEFLATE: deflate(buffer,stage.parameter); break;
+      case H5Z_FILTER_SHUFFLE: shuffle(buffer,stage.parameter,true); break;
+      case H5Z_FILTER_FLETCHER32: encode_fletcher32(buffer); break;
+      default: break;
+    }
+  }
+  return filter_mask;
+}
+
+void FilterPipeline::decode(Buffer &buffer,std::uint32_t filter_mask,
+                            size_t size_hint) const
+{
+  for(size_t index = stages_.size(); index-- > 0;)
+  {
+    const Stage &stage = stages_[index];
+    if(filter_mask & (1u << index))
+      continue;
+
+    if(stage.skip)
+    {
+      std::stringstream ss;
+      ss<<"Chunk was encoded with filter ["<<stage.id
+        <<"] which cannot be applied outside of libhdf5!";
+      throw std::runtime_error(ss.str());
+    }
+
+    switch(stage.id)
+    {
+      case H5Z_FILTER_DEFLATE: inflate(buffer,size_hint); break;
+      case H5Z_FILTER_SHUFFLE: shuffle(buffer,stage.parameter,false); break;
+      case H5Z_FILTER_FLETCHER32: decode_fletcher32(buffer); break;
+      default: break;
+    }
+  }
+}
+
+bool FilterPipeline::is_supported(FilterID id) noexcept
+{
+  return id == H5Z_FILTER_DEFLATE || id == H5Z_FILTER_SHUFFLE ||
+         id == H5Z_FILTER_FLETCHER32;
+}
+
+} // namespace filter
+} // namespace hdf5
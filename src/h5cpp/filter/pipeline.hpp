@@ -0,0 +1,164 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <h5cpp/core/windows.hpp>
+#include <h5cpp/filter/external_filter.hpp>
+#include <h5cpp/filter/types.hpp>
+#include <h5cpp/property/dataset_creation.hpp>
+
+namespace hdf5 {
+namespace filter {
+
+//!
+//! \brief in-memory implementation of a dataset filter pipeline
+//!
+//! A FilterPipeline applies the filters of a dataset to chunk buffers
+//! outside of libhdf5. This allows chunks to be encoded (or decoded) on
+//! any thread and to exchange the encoded bytes with the file via direct
+//! chunk IO.
+//!
+//! The output is bit compatible with the filters provided by libhdf5. The
+//! following filters are supported
+//!
+//! - \c H5Z_FILTER_DEFLATE
+//! - \c H5Z_FILTER_SHUFFLE
+//! - \c H5Z_FILTER_FLETCHER32
+//!
+//! Optional filters which are not supported are skipped during encoding and
+//! marked as such in the filter mask. Unsupported mandatory filters cause
+//! construction to fail.
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+class DLL_EXPORT FilterPipeline
+{
+  public:
+    //!
+    //! \brief buffer type used for encoding and decoding
+    //!
+    using Buffer = std::vector<unsigned char>;
+
+    //!
+    //! \brief constructor
+    //!
+    //! Construct the pipeline from the filters of a dataset creation
+    //! property list - usually the one of an existing dataset, as libhdf5
+    //! completes some filter parameters (like the element size for shuffle)
+    //! only when the dataset is created.
+    //!
+    //! \throws std::runtime_error if a mandatory filter is not supported
+    //! \param dcpl reference to the dataset creation property list
+    //! \param element_size size of a single element in bytes
+    //!
+    FilterPipeline(const property::DatasetCreationList &dcpl,
+                   size_t element_size);
+
+    //!
+    //! \brief constructor
+    //!
+    //! All filters are treated as mandatory.
+    //!
+    //! \throws std::runtime_error if one of the filters is not supported
+    //! \param filters the filters in the order in which they are applied
+    //! \param element_size size of a single element in bytes
+    //!
+    FilterPipeline(const ExternalFilters &filters,size_t element_size);
+
+    //!
+    //! \brief number of filters in the pipeline
+    //!
+    size_t size() const noexcept;
+
+    //!
+    //! \brief true if the pipeline has no filters to apply
+    //!
+    bool empty() const noexcept;
+
+    //!
+    //! \brief encode a chunk
+    //!
+    //! Applies all filters in pipeline order. The buffer is replaced by the
+    //! encoded data.
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param buffer the raw chunk data - replaced by the encoded data
+    //! \return filter mask with a bit set for every skipped filter
+    //!
+    std::uint32_t encode(Buffer &buffer) const;
+
+    //!
+    //! \brief decode a chunk
+    //!
+    //! Applies all filters not marked in the filter mask in reverse
+    //! pipeline order.
+    //!
+    //! \throws std::runtime_error in case of a failure (this includes
+    //!                            checksum errors)
+    //! \param buffer the encoded chunk data - replaced by the decoded data
+    //! \param filter_mask the filter mask stored with the chunk
+    //! \param size_hint expected size of the decoded chunk in bytes
+    //!
+    void decode(Buffer &buffer,std::uint32_t filter_mask = 0,
+                size_t size_hint = 0) const;
+
+    //!
+    //! \brief check if a filter can be applied by the pipeline
+    //!
+    //! \param id the ID of the filter
+    //! \return true if the filter is supported
+    //!
+    static bool is_supported(FilterID id) noexcept;
+
+  private:
+    struct Stage
+    {
+      FilterID id;
+      unsigned int parameter;
+      bool skip;
+    };
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+    std::vector<Stage> stages_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+    void append(const ExternalFilter &filter,Availability flag,
+                size_t element_size);
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+} // namespace filter
+} // namespace hdf5
@@ -36,14 +36,21 @@
 #include <h5cpp/core/windows.hpp>
 #include <h5cpp/core/variable_length_string.hpp>
 #include <h5cpp/core/fixed_length_string.hpp>
+#include <h5cpp/core/thread_pool.hpp>
+#include <h5cpp/core/task_queue.hpp>
+#include <h5cpp/core/executor.hpp>
+#include <h5cpp/core/string_arena.hpp>
 
 #include <h5cpp/attribute/attribute_iterator.hpp>
 #include <h5cpp/attribute/attribute_manager.hpp>
 #include <h5cpp/attribute/attribute.hpp>
+#include <h5cpp/attribute/attribute_value.hpp>
+#include <h5cpp/attribute/attribute_cache.hpp>
 
 #include <h5cpp/error/error.hpp>
 
 #include <h5cpp/datatype/compound.hpp>
+#include <h5cpp/datatype/compound_trait.hpp>
 #include <h5cpp/datatype/datatype.hpp>
 #include <h5cpp/datatype/factory.hpp>
 #include <h5cpp/datatype/float.hpp>
@@ -53,6 +60,7 @@
 #include <h5cpp/datatype/string.hpp>
 #include <h5cpp/datatype/array.hpp>
 #include <h5cpp/datatype/enum.hpp>
+#include <h5cpp/datatype/type_cache.hpp>
 
 #include <h5cpp/dataspace/dataspace.hpp>
 #include <h5cpp/dataspace/hyperslab.hpp>
@@ -71,6 +79,7 @@
 #include <h5cpp/file/types.hpp>
 #include <h5cpp/file/driver.hpp>
 #include <h5cpp/file/direct_driver.hpp>
+#include <h5cpp/file/io_uring_driver.hpp>
 #include <h5cpp/file/memory_driver.hpp>
 #include <h5cpp/file/mpi_driver.hpp>
 #include <h5cpp/file/posix_driver.hpp>
@@ -84,10 +93,12 @@
 #include <h5cpp/filter/shuffle.hpp>
 #include <h5cpp/filter/szip.hpp>
 #include <h5cpp/filter/external_filter.hpp>
+#include <h5cpp/filter/pipeline.hpp>
 
 #include <h5cpp/node/dataset.hpp>
 #include <h5cpp/node/group_view.hpp>
 #include <h5cpp/node/group.hpp>
+#include <h5cpp/node/link_listing.hpp>
 #include <h5cpp/node/link_view.hpp>
 #include <h5cpp/node/link.hpp>
 #include <h5cpp/node/node.hpp>
@@ -98,7 +109,16 @@
 #include <h5cpp/node/types.hpp>
 #include <h5cpp/node/chunked_dataset.hpp>
 #include <h5cpp/node/recursive_node_iterator.hpp>
+#include <h5cpp/node/scan.hpp>
+#include <h5cpp/node/path_cache.hpp>
+#include <h5cpp/node/chunk_cache_tuner.hpp>
 #include <h5cpp/node/recursive_link_iterator.hpp>
+#include <h5cpp/node/async_dataset.hpp>
+#include <h5cpp/node/chunk_grid.hpp>
+#include <h5cpp/node/chunk_reader.hpp>
+#include <h5cpp/node/chunk_writer.hpp>
+#include <h5cpp/node/stream_writer.hpp>
+#include <h5cpp/node/write_behind_dataset.hpp>
 #if (defined(_DOXYGEN_) || H5_VERSION_GE(1,10,0))
 #include <h5cpp/node/virtual_dataset.hpp>
 #endif
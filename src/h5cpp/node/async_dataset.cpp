@@ -0,0 +1,65 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+
+#include <stdexcept>
+#include <h5cpp/node/async_dataset.hpp>
+
+namespace hdf5 {
+namespace node {
+
+AsyncDataset::AsyncDataset(const Dataset &dataset):
+    dataset_(dataset),
+    worker_dataset_(dataset),
+    queue_(nullptr)
+{
+  if(!dataset_.is_valid())
+  {
+    throw std::runtime_error("Cannot create an AsyncDataset from an invalid dataset!");
+  }
+  queue_.reset(new TaskQueue());
+}
+
+AsyncDataset::~AsyncDataset()
+{
+  // joins the worker before the datasets are released
+  queue_.reset();
+}
+
+const Dataset &AsyncDataset::dataset() const noexcept
+{
+  return dataset_;
+}
+
+void AsyncDataset::wait() const
+{
+  queue_->wait();
+}
+
+size_t AsyncDataset::pending() const
+{
+  return queue_->pending();
+}
+
+} // namespace node
+} // namespace hdf5
@@ -0,0 +1,262 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <h5cpp/core/executor.hpp>
+#include <h5cpp/core/task_queue.hpp>
+#include <h5cpp/core/windows.hpp>
+#include <h5cpp/dataspace/hyperslab.hpp>
+#include <h5cpp/node/dataset.hpp>
+
+namespace hdf5 {
+namespace node {
+
+//!
+//! \brief asynchronous IO facade for a dataset
+//!
+//! An AsyncDataset issues all reads and writes on a dataset from a dedicated
+//! IO worker thread. Every operation returns immediately with a future and
+//! is executed after all operations previously submitted to the same
+//! instance, so the order of operations on a dataset is preserved.
+//!
+//! The data passed to an operation is moved into the operation and owned by
+//! it until the operation has finished. For reads the filled buffer is handed
+//! back via the future. An optional completion callback is invoked on the
+//! worker thread once the operation has finished; it receives a null
+//! exception pointer on success or the exception which caused the failure.
+//! The callback must not throw.
+//!
+//! \code
+//! node::AsyncDataset async(dataset);
+//! auto done = async.write(std::move(frame),selection);
+//! // ... acquire the next frame
+//! done.get(); // rethrows if the write failed
+//! \endcode
+//!
+//! The operations are executed via concurrency::Executor. Unless libhdf5
+//! is built thread-safe the calling thread must not issue other HDF5 calls
+//! while operations are pending, except through the Executor.
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+class DLL_EXPORT AsyncDataset
+{
+  public:
+    //!
+    //! \brief completion callback type
+    //!
+    using Callback = std::function<void(std::exception_ptr)>;
+
+    //!
+    //! \brief constructor
+    //!
+    //! \throws std::runtime_error if the dataset is not valid
+    //! \param dataset the dataset to which all operations are applied
+    //!
+    AsyncDataset(const Dataset &dataset);
+
+    //!
+    //! \brief destructor
+    //!
+    //! Waits for all pending operations to finish.
+    //!
+    ~AsyncDataset();
+
+    AsyncDataset(const AsyncDataset &) = delete;
+    AsyncDataset &operator=(const AsyncDataset &) = delete;
+
+    //!
+    //! \brief get the dataset
+    //!
+    const Dataset &dataset() const noexcept;
+
+    //!
+    //! \brief write the entire dataset asynchronously
+    //!
+    //! \tparam T source type
+    //! \param data the data to write - ownership is taken
+    //! \param callback optional completion callback
+    //! \return future becoming ready once the data has been written
+    //!
+    template<typename T>
+    std::future<void> write(T data,Callback callback = Callback());
+
+    //!
+    //! \brief write to a selection asynchronously
+    //!
+    //! \tparam T source type
+    //! \param data the data to write - ownership is taken
+    //! \param selection the hyperslab in the dataset to write to
+    //! \param callback optional completion callback
+    //! \return future becoming ready once the data has been written
+    //!
+    template<typename T>
+    std::future<void> write(T data,const dataspace::Hyperslab &selection,
+                            Callback callback = Callback());
+
+    //!
+    //! \brief read the entire dataset asynchronously
+    //!
+    //! \tparam T destination type
+    //! \param data the buffer to read to - ownership is taken
+    //! \param callback optional completion callback
+    //! \return future providing the filled buffer
+    //!
+    template<typename T>
+    std::future<T> read(T data,Callback callback = Callback());
+
+    //!
+    //! \brief read a selection asynchronously
+    //!
+    //! \tparam T destination type
+    //! \param data the buffer to read to - ownership is taken
+    //! \param selection the hyperslab in the dataset to read from
+    //! \param callback optional completion callback
+    //! \return future providing the filled buffer
+    //!
+    template<typename T>
+    std::future<T> read(T data,const dataspace::Hyperslab &selection,
+                        Callback callback = Callback());
+
+    //!
+    //! \brief wait for all pending operations
+    //!
+    //! Unlike the futures this does not report failures - they are only
+    //! delivered via the futures and callbacks of the individual operations.
+    //!
+    void wait() const;
+
+    //!
+    //! \brief number of pending operations
+    //!
+    size_t pending() const;
+
+  private:
+    template<typename F>
+    auto submit(F &&operation,Callback &&callback)
+        -> std::future<decltype(operation())>;
+
+    template<typename F>
+    static void complete(F &operation,const Callback &callback,std::true_type);
+
+    template<typename F>
+    static auto complete(F &operation,const Callback &callback,std::false_type)
+        -> decltype(operation());
+
+    Dataset dataset_;
+    //! the instance used exclusively on the worker thread
+    Dataset worker_dataset_;
+    std::unique_ptr<TaskQueue> queue_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+template<typename F>
+void AsyncDataset::complete(F &operation,const Callback &callback,std::true_type)
+{
+  concurrency::Executor::instance().run(operation);
+  if(callback) callback(nullptr);
+}
+
+template<typename F>
+auto AsyncDataset::complete(F &operation,const Callback &callback,std::false_type)
+    -> decltype(operation())
+{
+  auto result = concurrency::Executor::instance().run(operation);
+  if(callback) callback(nullptr);
+  return result;
+}
+
+template<typename F>
+auto AsyncDataset::submit(F &&operation,Callback &&callback)
+    -> std::future<decltype(operation())>
+{
+  using ResultType = decltype(operation());
+
+  return queue_->submit(
+      [op = std::forward<F>(operation),cb = std::move(callback)]() mutable
+          -> ResultType
+  {
+    try
+    {
+      return complete(op,cb,std::is_void<ResultType>());
+    }
+    catch(...)
+    {
+      if(cb) cb(std::current_exception());
+      throw;
+    }
+  });
+}
+
+template<typename T>
+std::future<void> AsyncDataset::write(T data,Callback callback)
+{
+  Dataset &dataset = worker_dataset_;
+  return submit([&dataset,data = std::move(data)]() { dataset.write(data); },
+                std::move(callback));
+}
+
+template<typename T>
+std::future<void> AsyncDataset::write(T data,
+                                      const dataspace::Hyperslab &selection,
+                                      Callback callback)
+{
+  Dataset &dataset = worker_dataset_;
+  return submit([&dataset,data = std::move(data),selection]()
+                { dataset.write(data,selection); },
+                std::move(callback));
+}
+
+template<typename T>
+std::future<T> AsyncDataset::read(T data,Callback callback)
+{
+  Dataset &dataset = worker_dataset_;
+  return submit([&dataset,data = std::move(data)]() mutable
+                { dataset.read(data); return std::move(data); },
+                std::move(callback));
+}
+
+template<typename T>
+std::future<T> AsyncDataset::read(T data,
+                                  const dataspace::Hyperslab &selection,
+                                  Callback callback)
+{
+  Dataset &dataset = worker_dataset_;
+  return submit([&dataset,data = std::move(data),selection]() mutable
+                { dataset.read(data,selection); return std::move(data); },
+                std::move(callback));
+}
+
+} // namespace node
+} // namespace hdf5
@@ -0,0 +1,248 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <h5cpp/node/chunk_cache_tuner.hpp>
+#include <h5cpp/core/utilities.hpp>
+#include <h5cpp/error/error.hpp>
+
+namespace hdf5 {
+namespace node {
+
+namespace {
+
+//
+// upper limit for the number of hash slots, every slot costs a pointer
+//
+constexpr size_t max_slots = 1048573;
+constexpr size_t min_slots = 521;
+
+bool is_prime(size_t value)
+{
+  if(value<2) return false;
+  for(size_t divisor=2; divisor*divisor<=value; ++divisor)
+    if(value%divisor==0) return false;
+  return true;
+}
+
+size_t slots_for(size_t chunks)
+{
+  size_t slots = std::min(std::max(min_slots,100*chunks),max_slots);
+  while(!is_prime(slots)) --slots;
+  return slots;
+}
+
+//
+// the chunks touched by a selection
+//
+struct Footprint
+{
+  size_t chunk_bytes;
+  size_t chunks;
+  bool whole_chunks;
+  bool filtered;
+};
+
+std::string dataset_path(const Dataset &dataset)
+{
+  return static_cast<std::string>(dataset.link().path());
+}
+
+Footprint footprint(const Dataset &dataset,const dataspace::Selection &selection)
+{
+  auto dcpl = dataset.creation_list();
+  if(dcpl.layout()!=property::DatasetLayout::Chunked)
+  {
+    std::stringstream ss;
+    ss<<"Dataset ["<<dataset_path(dataset)<<"] is not chunked!";
+    throw std::runtime_error(ss.str());
+  }
+  Dimensions chunk = dcpl.chunk();
+
+  dataspace::Dataspace space = dataset.dataspace();
+  Dimensions extent = dataspace::Simple(space).current_dimensions();
+  space.selection(dataspace::SelectionOperation::Set,selection);
+  hid_t space_id = static_cast<hid_t>(space);
+
+  size_t element_size = dataset.datatype().size();
+  Footprint result{element_size,1,true,dcpl.nfilters()>0};
+  hssize_t npoints = H5Sget_select_npoints(space_id);
+  if(npoints<0)
+    error::Singleton::instance().throw_with_stack(
+        "Failure to count the selected elements of dataset ["+
+        dataset_path(dataset)+"]!");
+  if(npoints==0)
+  {
+    result.chunks = 0;
+    return result;
+  }
+
+  Dimensions start(chunk.size()),end(chunk.size());
+  if(H5Sget_select_bounds(space_id,start.data(),end.data())<0)
+    error::Singleton::instance().throw_with_stack(
+        "Failure to retrieve the selection bounds for dataset ["+
+        dataset_path(dataset)+"]!");
+
+  hsize_t box = 1;
+  for(size_t index=0; index<chunk.size(); ++index)
+  {
+    hsize_t first = start[index]/chunk[index];
+    hsize_t last = end[index]/chunk[index];
+    result.chunk_bytes *= chunk[index];
+    result.chunks *= last-first+1;
+    box *= end[index]-start[index]+1;
+    if(start[index]%chunk[index]!=0 ||
+       ((end[index]+1)%chunk[index]!=0 && end[index]+1!=extent[index]))
+      result.whole_chunks = false;
+  }
+  if(box!=signed2unsigned<hsize_t>(npoints))
+    result.whole_chunks = false;
+
+  return result;
+}
+
+property::ChunkCacheParameters parameters(const Footprint &footprint,
+                                          size_t budget)
+{
+  const double w0 = 0.75;
+  size_t required = footprint.chunks*footprint.chunk_bytes;
+  if(footprint.whole_chunks || footprint.chunks==0 ||
+     (required>budget && !footprint.filtered) ||
+     budget<footprint.chunk_bytes)
+    return property::ChunkCacheParameters(min_slots,0,w0);
+
+  size_t nbytes = std::min(required,budget);
+  return property::ChunkCacheParameters(
+      slots_for(nbytes/footprint.chunk_bytes),nbytes,w0);
+}
+
+} // anonymous namespace
+
+ChunkCacheTuner &ChunkCacheTuner::instance()
+{
+  static ChunkCacheTuner tuner;
+  return tuner;
+}
+
+ChunkCacheTuner::ChunkCacheTuner():
+    mutex_(),
+    ceiling_(default_ceiling),
+    reservations_()
+{}
+
+void ChunkCacheTuner::ceiling(size_t bytes)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  ceiling_ = bytes;
+}
+
+size_t ChunkCacheTuner::ceiling() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return ceiling_;
+}
+
+void ChunkCacheTuner::sweep() const
+{
+  for(auto entry=reservations_.begin(); entry!=reservations_.end();)
+  {
+    if(H5Iis_valid(entry->first)>0)
+      ++entry;
+    else
+      entry = reservations_.erase(entry);
+  }
+}
+
+size_t ChunkCacheTuner::reserved() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  sweep();
+  size_t total = 0;
+  for(const auto &entry: reservations_)
+    total += entry.second;
+  return total;
+}
+
+property::ChunkCacheParameters
+ChunkCacheTuner::suggest(const Dataset &dataset,
+                         const dataspace::Selection &selection) const
+{
+  return parameters(footprint(dataset,selection),
+                    std::numeric_limits<size_t>::max());
+}
+
+property::ChunkCacheParameters
+ChunkCacheTuner::tune(Dataset &dataset,const dataspace::Selection &selection)
+{
+  Footprint print = footprint(dataset,selection);
+  Link link = dataset.link();
+  std::string path = static_cast<std::string>(link.path());
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  sweep();
+  reservations_.erase(static_cast<hid_t>(dataset));
+  size_t total = 0;
+  for(const auto &entry: reservations_)
+    total += entry.second;
+  size_t budget = total<ceiling_ ? ceiling_-total : 0;
+  property::ChunkCacheParameters params = parameters(print,budget);
+
+  property::DatasetAccessList dapl;
+  dapl.chunk_cache_parameters(params);
+
+  //
+  // the chunk cache is shared by all handles of a dataset and is only
+  // created when the first handle is opened
+  //
+  dataset = Dataset();
+  hid_t id = H5Dopen2(static_cast<hid_t>(link.file()),path.c_str(),
+                      static_cast<hid_t>(dapl));
+  if(id<0)
+    error::Singleton::instance().throw_with_stack(
+        "Failure to reopen dataset ["+path+"] with a tuned chunk cache!");
+  dataset = Dataset(Node(ObjectHandle(id),link));
+
+  if(params.chunk_cache_size()>0)
+    reservations_[id] = params.chunk_cache_size();
+  return params;
+}
+
+void ChunkCacheTuner::release(const Dataset &dataset)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  reservations_.erase(static_cast<hid_t>(dataset));
+}
+
+void ChunkCacheTuner::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  reservations_.clear();
+  ceiling_ = default_ceiling;
+}
+
+} // namespace node
+} // namespace hdf5
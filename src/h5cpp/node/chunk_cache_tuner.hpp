@@ -0,0 +1,187 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <h5cpp/core/hdf5_capi.hpp>
+#include <h5cpp/core/windows.hpp>
+#include <h5cpp/dataspace/selection.hpp>
+#include <h5cpp/node/dataset.hpp>
+#include <h5cpp/property/dataset_access.hpp>
+
+namespace hdf5 {
+namespace node {
+
+//!
+//! \brief sizes the chunk cache of datasets for a selection
+//!
+//! The default chunk cache of libhdf5 holds 1 MiB. A selection which cuts
+//! through more chunks than fit into the cache, like a transposed slice,
+//! evicts every chunk before it is used again. For filtered datasets this
+//! means that each chunk is read and decompressed once per access.
+//!
+//! suggest() derives cache parameters from the chunk shape, the element
+//! size, the filters of a dataset and the chunks touched by a selection:
+//!
+//! \li the cache holds all chunks within the bounding box of the selection
+//! \li the number of slots is a prime of about 100 times the number of
+//!     cached chunks, limited to about one million slots
+//! \li no cache is used if the selection covers whole chunks, and for
+//!     unfiltered datasets if the budget cannot hold all touched chunks,
+//!     as libhdf5 then reads the data directly from the file
+//! \li filtered datasets get as much of the budget as is left if it cannot
+//!     hold all touched chunks
+//!
+//! tune() reopens a dataset with the suggested parameters. The memory of
+//! all tuned datasets which are still open is limited by a process-wide
+//! ceiling. Reservations are released when the dataset is closed.
+//!
+//! libhdf5 shares the chunk cache between all handles of an open dataset.
+//! The new parameters only take effect if no other handle to the dataset is
+//! open.
+//!
+//! All member functions are thread-safe.
+//!
+//! \code
+//! auto &tuner = node::ChunkCacheTuner::instance();
+//! tuner.ceiling(512*1024*1024);
+//! dataspace::Hyperslab column{{0,10},{rows,1}};
+//! tuner.tune(dataset,column);
+//! for(size_t index=0; index<columns; ++index)
+//! {
+//!   column.offset(1,index);
+//!   dataset.read(buffer,column);
+//! }
+//! \endcode
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+class DLL_EXPORT ChunkCacheTuner
+{
+  public:
+    //!
+    //! \brief default process-wide ceiling (256 MiB)
+    //!
+    static constexpr size_t default_ceiling = 256*1024*1024;
+
+    //!
+    //! \brief reference to the process-wide tuner
+    //!
+    static ChunkCacheTuner &instance();
+
+    ChunkCacheTuner(const ChunkCacheTuner &) = delete;
+    ChunkCacheTuner &operator=(const ChunkCacheTuner &) = delete;
+
+    //!
+    //! \brief set the memory ceiling for all tuned datasets
+    //!
+    //! Existing reservations are kept even if they exceed the new ceiling.
+    //!
+    //! \param bytes the ceiling in bytes
+    //!
+    void ceiling(size_t bytes);
+
+    //!
+    //! \brief get the memory ceiling for all tuned datasets
+    //!
+    size_t ceiling() const;
+
+    //!
+    //! \brief memory reserved by tuned datasets which are still open
+    //!
+    size_t reserved() const;
+
+    //!
+    //! \brief compute cache parameters for a selection
+    //!
+    //! The result is not limited by the ceiling.
+    //!
+    //! \throws std::runtime_error if the dataset is not chunked or in case
+    //!                            of a failure
+    //! \param dataset the dataset
+    //! \param selection the selection which will be read
+    //! \return the suggested parameters
+    //!
+    property::ChunkCacheParameters suggest(const Dataset &dataset,
+                                           const dataspace::Selection &selection) const;
+
+    //!
+    //! \brief reopen a dataset with a chunk cache sized for a selection
+    //!
+    //! Computes the parameters with suggest(), limits the size of the cache
+    //! to the part of the ceiling not reserved by other datasets and
+    //! replaces dataset by a new handle opened with these parameters. A
+    //! previous reservation of the dataset is released first.
+    //!
+    //! \throws std::runtime_error if the dataset is not chunked or in case
+    //!                            of a failure
+    //! \param dataset the dataset, replaced by the reopened dataset
+    //! \param selection the selection which will be read
+    //! \return the parameters used for the dataset
+    //!
+    property::ChunkCacheParameters tune(Dataset &dataset,
+                                        const dataspace::Selection &selection);
+
+    //!
+    //! \brief release the reservation of a dataset
+    //!
+    //! The cache of the dataset stays in place until it is closed.
+    //!
+    //! \param dataset the dataset
+    //!
+    void release(const Dataset &dataset);
+
+    //!
+    //! \brief release all reservations and restore the default ceiling
+    //!
+    void clear();
+
+  private:
+    ChunkCacheTuner();
+
+    //
+    // drops the reservations of closed datasets, requires mutex_ to be held
+    //
+    void sweep() const;
+
+    mutable std::mutex mutex_;
+    size_t ceiling_;
+    mutable std::unordered_map<hid_t,size_t> reservations_;
+};
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+} // namespace node
+} // namespace hdf5
@@ -0,0 +1,176 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <h5cpp/node/chunk_grid.hpp>
+
+namespace hdf5 {
+namespace node {
+
+ChunkGrid::ChunkGrid(const Dimensions &chunk_dims,const Dimensions &offset,
+                     const Dimensions &block):
+    chunk_dims_(chunk_dims),
+    offset_(offset),
+    block_(block),
+    first_(chunk_dims.size()),
+    counts_(chunk_dims.size()),
+    size_(1)
+{
+  if(chunk_dims_.empty() || offset_.size() != chunk_dims_.size() ||
+     block_.size() != chunk_dims_.size())
+  {
+    std::stringstream ss;
+    ss<<"Chunk rank ("<<chunk_dims_.size()<<"), offset rank ("<<offset_.size()
+      <<") and block rank ("<<block_.size()<<") do not match!";
+    throw std::runtime_error(ss.str());
+  }
+
+  for(size_t d = 0; d < chunk_dims_.size(); ++d)
+  {
+    if(chunk_dims_[d] == 0 || block_[d] == 0)
+      throw std::runtime_error("Chunk and block dimensions must not be zero!");
+
+    first_[d] = offset_[d] / chunk_dims_[d];
+    counts_[d] = (offset_[d] + block_[d] - 1) / chunk_dims_[d] - first_[d] + 1;
+    size_ *= counts_[d];
+  }
+}
+
+size_t ChunkGrid::size() const noexcept
+{
+  return size_;
+}
+
+size_t ChunkGrid::chunk_elements() const noexcept
+{
+  size_t elements = 1;
+  for(auto dim: chunk_dims_)
+    elements *= dim;
+  return elements;
+}
+
+size_t ChunkGrid::block_elements() const noexcept
+{
+  size_t elements = 1;
+  for(auto dim: block_)
+    elements *= dim;
+  return elements;
+}
+
+Dimensions ChunkGrid::chunk_offset(size_t index) const
+{
+  if(index >= size_)
+  {
+    std::stringstream ss;
+    ss<<"Chunk index "<<index<<" exceeds number of chunks "<<size_<<"!";
+    throw std::out_of_range(ss.str());
+  }
+
+  Dimensions origin(chunk_dims_.size());
+  for(size_t d = chunk_dims_.size(); d-- > 0;)
+  {
+    origin[d] = (first_[d] + index % counts_[d]) * chunk_dims_[d];
+    index /= counts_[d];
+  }
+  return origin;
+}
+
+bool ChunkGrid::covers(size_t index) const
+{
+  Dimensions origin = chunk_offset(index);
+  for(size_t d = 0; d < chunk_dims_.size(); ++d)
+  {
+    if(origin[d] < offset_[d] ||
+       origin[d] + chunk_dims_[d] > offset_[d] + block_[d])
+      return false;
+  }
+  return true;
+}
+
+void ChunkGrid::gather(const void *block_data,size_t index,void *chunk_data,
+                       size_t element_size) const
+{
+  copy(index,static_cast<const unsigned char*>(block_data),
+       static_cast<unsigned char*>(chunk_data),element_size,true);
+}
+
+void ChunkGrid::scatter(const void *chunk_data,size_t index,void *block_data,
+                        size_t element_size) const
+{
+  copy(index,static_cast<const unsigned char*>(chunk_data),
+       static_cast<unsigned char*>(block_data),element_size,false);
+}
+
+void ChunkGrid::copy(size_t index,const unsigned char *source,
+                     unsigned char *target,size_t element_size,
+                     bool to_chunk) const
+{
+  size_t rank = chunk_dims_.size();
+  Dimensions origin = chunk_offset(index);
+  Dimensions lower(rank), upper(rank);
+  for(size_t d = 0; d < rank; ++d)
+  {
+    lower[d] = std::max(origin[d],offset_[d]);
+    upper[d] = std::min(origin[d] + chunk_dims_[d],offset_[d] + block_[d]);
+  }
+
+  // the intersection is copied row by row along the last dimension
+  size_t row_size = (upper[rank - 1] - lower[rank - 1]) * element_size;
+  Dimensions position(lower);
+  while(true)
+  {
+    size_t chunk_index = 0, block_index = 0;
+    for(size_t d = 0; d < rank; ++d)
+    {
+      chunk_index = chunk_index * chunk_dims_[d] + (position[d] - origin[d]);
+      block_index = block_index * block_[d] + (position[d] - offset_[d]);
+    }
+
+    if(to_chunk)
+      std::memcpy(target + chunk_index * element_size,
+                  source + block_index * element_size,row_size);
+    else
+      std::memcpy(target + block_index * element_size,
+                  source + chunk_index * element_size,row_size);
+
+    bool done = true;
+    for(size_t d = rank - 1; d-- > 0;)
+    {
+      if(++position[d] < upper[d])
+      {
+        done = false;
+        break;
+      }
+      position[d] = lower[d];
+    }
+    if(done)
+      break;
+  }
+}
+
+} // namespace node
+} // namespace hdf5
@@ -0,0 +1,134 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <cstddef>
+#include <h5cpp/core/types.hpp>
+#include <h5cpp/core/windows.hpp>
+
+namespace hdf5 {
+namespace node {
+
+//!
+//! \brief chunks of a dataset touched by a block selection
+//!
+//! A ChunkGrid describes all chunks of a chunked dataset which intersect a
+//! rectangular block of elements. The chunks are enumerated in row-major
+//! order. For every chunk the grid can copy the intersecting elements
+//! between a chunk buffer and a buffer holding the entire block (both in
+//! row-major order).
+//!
+//! This is the common ground for all components which perform IO on whole
+//! chunks, like ChunkWriter and ChunkReader.
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+class DLL_EXPORT ChunkGrid
+{
+  public:
+    //!
+    //! \brief constructor
+    //!
+    //! \throws std::runtime_error if the ranks do not match or if a chunk or
+    //!                            block dimension is zero
+    //! \param chunk_dims number of elements of a chunk along each dimension
+    //! \param offset the offset of the block in the dataset
+    //! \param block number of elements of the block along each dimension
+    //!
+    ChunkGrid(const Dimensions &chunk_dims,const Dimensions &offset,
+              const Dimensions &block);
+
+    //!
+    //! \brief number of chunks intersecting the block
+    //!
+    size_t size() const noexcept;
+
+    //!
+    //! \brief number of elements in a chunk
+    //!
+    size_t chunk_elements() const noexcept;
+
+    //!
+    //! \brief number of elements in the block
+    //!
+    size_t block_elements() const noexcept;
+
+    //!
+    //! \brief logical offset of a chunk in the dataset
+    //!
+    //! \param index index of the chunk in the grid
+    //! \return offset of the first element of the chunk
+    //!
+    Dimensions chunk_offset(size_t index) const;
+
+    //!
+    //! \brief check whether a chunk is entirely covered by the block
+    //!
+    //! \param index index of the chunk in the grid
+    //!
+    bool covers(size_t index) const;
+
+    //!
+    //! \brief copy elements from the block to a chunk
+    //!
+    //! Elements of the chunk outside of the block are not touched.
+    //!
+    //! \param block_data pointer to the data of the entire block
+    //! \param index index of the chunk in the grid
+    //! \param chunk_data pointer to the chunk buffer
+    //! \param element_size size of an element in bytes
+    //!
+    void gather(const void *block_data,size_t index,void *chunk_data,
+                size_t element_size) const;
+
+    //!
+    //! \brief copy elements from a chunk to the block
+    //!
+    //! \param chunk_data pointer to the chunk buffer
+    //! \param index index of the chunk in the grid
+    //! \param block_data pointer to the data of the entire block
+    //! \param element_size size of an element in bytes
+    //!
+    void scatter(const void *chunk_data,size_t index,void *block_data,
+                 size_t element_size) const;
+
+  private:
+    Dimensions chunk_dims_;
+    Dimensions offset_;
+    Dimensions block_;
+    Dimensions first_;
+    Dimensions counts_;
+    size_t size_;
+
+    void copy(size_t index,const unsigned char *source,unsigned char *target,
+              size_t element_size,bool to_chunk) const;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+} // namespace node
+} // namespace hdf5
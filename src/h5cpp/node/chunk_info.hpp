@@ -0,0 +1,75 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <cstdint>
+#include <h5cpp/core/hdf5_capi.hpp>
+#include <h5cpp/core/types.hpp>
+
+namespace hdf5 {
+namespace node {
+
+//!
+//! \brief storage information of a single chunk
+//!
+//! Describes where and how a chunk of a chunked dataset is stored in the
+//! file. Chunks which have not been written yet have no address and a
+//! storage size of 0.
+//!
+//! \sa Dataset::chunk_info
+//! \sa Dataset::chunks
+//!
+struct ChunkInfo
+{
+  //!
+  //! \brief logical position of the first element of the chunk
+  //!
+  Dimensions offset;
+
+  //!
+  //! \brief mask of the filters skipped for the chunk
+  //!
+  std::uint32_t filter_mask;
+
+  //!
+  //! \brief address of the chunk in the file
+  //!
+  haddr_t address;
+
+  //!
+  //! \brief number of bytes stored for the chunk
+  //!
+  hsize_t size;
+
+  //!
+  //! \brief true if storage has been allocated for the chunk
+  //!
+  bool is_allocated() const noexcept
+  {
+    return address != HADDR_UNDEF;
+  }
+};
+
+} // namespace node
+} // namespace hdf5
@@ -0,0 +1,250 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <sstream>
+#include <stdexcept>
+#include <h5cpp/core/executor.hpp>
+#include <h5cpp/error/error.hpp>
+#include <h5cpp/node/chunk_grid.hpp>
+#include <h5cpp/node/chunk_reader.hpp>
+
+namespace hdf5 {
+namespace node {
+
+#if H5_VERSION_GE(1,10,2)
+
+namespace {
+
+Dimensions chunk_dimensions(const Dataset &dataset)
+{
+  auto dcpl = dataset.creation_list();
+  if(dcpl.layout() != property::DatasetLayout::Chunked)
+  {
+    std::stringstream ss;
+    ss<<"Dataset ["<<dataset.link().path()<<"] is not chunked!";
+    throw std::runtime_error(ss.str());
+  }
+  return dcpl.chunk();
+}
+
+datatype::Datatype fixed_size_type(const Dataset &dataset)
+{
+  auto type = dataset.datatype();
+  if(!datatype::is_fixed_size(type))
+  {
+    std::stringstream ss;
+    ss<<"Dataset ["<<dataset.link().path()<<"] has a variable length type"
+      <<" which cannot be read chunk by chunk!";
+    throw std::runtime_error(ss.str());
+  }
+  return type;
+}
+
+filter::FilterPipeline::Buffer fill_value(const Dataset &dataset,
+                                          const datatype::Datatype &type)
+{
+  auto dcpl = dataset.creation_list();
+  filter::FilterPipeline::Buffer value(type.size(),0);
+  if(dcpl.fill_value_status() != property::DatasetFillValueStatus::Undefined)
+  {
+    if(H5Pget_fill_value(static_cast<hid_t>(dcpl),static_cast<hid_t>(type),
+                         value.data())<0)
+    {
+      std::stringstream ss;
+      ss<<"Failure to retrieve the fill value of dataset ["
+        <<dataset.link().path()<<"]!";
+      error::Singleton::instance().throw_with_stack(ss.str());
+    }
+  }
+  return value;
+}
+
+// size of a chunk in the file - 0 if the chunk has not been allocated
+hsize_t stored_size(const Dataset &dataset,const Dimensions &offset)
+{
+#if H5_VERSION_GE(1,10,5)
+  // chunk_storage_size() fails for chunks not allocated yet
+  return dataset.chunk_info(offset).size;
+#else
+  return dataset.chunk_storage_size(offset);
+#endif
+}
+
+} // anonymous namespace
+
+ChunkReader::ChunkReader(const Dataset &dataset,size_t threads):
+    dataset_(dataset),
+    file_type_(fixed_size_type(dataset)),
+    chunk_dims_(chunk_dimensions(dataset)),
+    element_size_(file_type_.size()),
+    pipeline_(dataset.creation_list(),element_size_),
+    fill_value_(fill_value(dataset,file_type_)),
+    pool_(new ThreadPool(threads))
+{}
+
+ChunkReader::~ChunkReader()
+{}
+
+const Dataset &ChunkReader::dataset() const noexcept
+{
+  return dataset_;
+}
+
+size_t ChunkReader::threads() const noexcept
+{
+  return pool_->size();
+}
+
+void ChunkReader::check_memory(const datatype::Datatype &mem_type,
+                               const dataspace::Dataspace &mem_space,
+                               size_t elements) const
+{
+  if(mem_type != file_type_)
+  {
+    std::stringstream ss;
+    ss<<"Memory type does not match the file type of dataset ["
+      <<dataset_.link().path()<<"] - ChunkReader does not convert types!";
+    throw std::runtime_error(ss.str());
+  }
+  if(signed2unsigned<size_t>(mem_space.size()) != elements)
+  {
+    std::stringstream ss;
+    ss<<"Number of elements in memory ("<<mem_space.size()
+      <<") does not match the size of the selection ("<<elements<<")!";
+    throw std::runtime_error(ss.str());
+  }
+}
+
+void ChunkReader::read(void *data,const Dimensions &offset,
+                       const Dimensions &block,
+                       const property::DatasetTransferList &dtpl) const
+{
+  auto &executor = concurrency::Executor::instance();
+  Dimensions dims = executor.run([this]()
+  { return dataspace::Simple(dataset_.dataspace()).current_dimensions(); });
+  if(offset.size() != dims.size() || block.size() != dims.size())
+  {
+    std::stringstream ss;
+    ss<<"Rank of block does not match the rank of dataset ["
+      <<dataset_.link().path()<<"]!";
+    throw std::runtime_error(ss.str());
+  }
+
+  for(size_t d = 0; d < dims.size(); ++d)
+  {
+    if(offset[d] + block[d] > dims[d])
+    {
+      std::stringstream ss;
+      ss<<"Block exceeds the extent of dataset ["<<dataset_.link().path()
+        <<"] along dimension "<<d<<"!";
+      throw std::runtime_error(ss.str());
+    }
+  }
+
+  // chunks still held in the chunk cache of libhdf5 are not visible to
+  // direct chunk reads
+  executor.run([this]()
+  {
+    if(H5Dflush(static_cast<hid_t>(dataset_))<0)
+    {
+      std::stringstream ss;
+      ss<<"Failure to flush dataset ["<<dataset_.link().path()<<"]!";
+      error::Singleton::instance().throw_with_stack(ss.str());
+    }
+  });
+
+  ChunkGrid grid(chunk_dims_,offset,block);
+  size_t chunk_size = grid.chunk_elements() * element_size_;
+
+  auto decode = [&](size_t index,filter::FilterPipeline::Buffer &chunk,
+                    std::uint32_t filter_mask)
+  {
+    if(chunk.empty())
+    {
+      // the chunk has not been allocated yet
+      chunk.resize(chunk_size);
+      for(size_t pos = 0; pos < chunk_size; pos += element_size_)
+        std::memcpy(chunk.data() + pos,fill_value_.data(),element_size_);
+    }
+    else
+    {
+      pipeline_.decode(chunk,filter_mask,chunk_size);
+      if(chunk.size() != chunk_size)
+      {
+        std::stringstream ss;
+        ss<<"Decoded chunk of dataset ["<<dataset_.link().path()<<"] has "
+          <<chunk.size()<<" bytes instead of "<<chunk_size<<"!";
+        throw std::runtime_error(ss.str());
+      }
+    }
+    grid.scatter(chunk.data(),index,data,element_size_);
+  };
+
+  // limit the number of raw chunks held in memory
+  const size_t window = 2 * pool_->size();
+  std::deque<std::future<void>> decoded;
+  try
+  {
+    for(size_t index = 0; index < grid.size(); ++index)
+    {
+      if(decoded.size() >= window)
+      {
+        decoded.front().get();
+        decoded.pop_front();
+      }
+
+      Dimensions chunk_offset = grid.chunk_offset(index);
+      auto chunk = std::make_shared<filter::FilterPipeline::Buffer>();
+      std::uint32_t filter_mask = executor.run([&]()
+      {
+        chunk->resize(static_cast<size_t>(stored_size(dataset_,chunk_offset)));
+        if(chunk->empty())
+          return std::uint32_t(0);
+        return dataset_.read_chunk(chunk->data(),chunk->size(),chunk_offset,dtpl);
+      });
+
+      decoded.push_back(pool_->submit([&decode,index,chunk,filter_mask]()
+                                      { decode(index,*chunk,filter_mask); }));
+    }
+
+    for(; !decoded.empty(); decoded.pop_front())
+      decoded.front().get();
+  }
+  catch(...)
+  {
+    // the tasks still refer to the destination buffer
+    for(auto &chunk: decoded)
+      if(chunk.valid())
+        chunk.wait();
+    throw;
+  }
+}
+
+#endif
+
+} // namespace node
+} // namespace hdf5
@@ -0,0 +1,207 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <h5cpp/core/executor.hpp>
+#include <h5cpp/core/thread_pool.hpp>
+#include <h5cpp/core/types.hpp>
+#include <h5cpp/core/utilities.hpp>
+#include <h5cpp/core/windows.hpp>
+#include <h5cpp/dataspace/hyperslab.hpp>
+#include <h5cpp/dataspace/simple.hpp>
+#include <h5cpp/dataspace/type_trait.hpp>
+#include <h5cpp/datatype/factory.hpp>
+#include <h5cpp/filter/pipeline.hpp>
+#include <h5cpp/node/dataset.hpp>
+#include <h5cpp/property/dataset_transfer.hpp>
+
+namespace hdf5 {
+namespace node {
+
+#if (defined(_DOXYGEN_) || H5_VERSION_GE(1,10,2))
+
+//!
+//! \brief parallel chunk decompression and direct chunk reading  (*since hdf5 1.10.2*)
+//!
+//! A ChunkReader reads a block of raw elements from a chunked dataset. The
+//! chunks intersecting the block are fetched from the file via direct
+//! chunk read on the calling thread while a pool of worker threads decodes
+//! them with the dataset's filters and scatters the elements into the
+//! destination buffer. Compared to a normal read, where libhdf5 runs the
+//! filters for one chunk after the other, the decompression throughput
+//! scales with the number of threads.
+//!
+//! The filters are applied by filter::FilterPipeline. Unlike the
+//! ChunkWriter the block can have an arbitrary offset and size within the
+//! current extent of the dataset. Chunks which have not been allocated yet
+//! are filled with the fill value of the dataset. As no type conversion is
+//! performed the destination must use the file type of the dataset.
+//!
+//! The HDF5 calls of read() are made via concurrency::Executor.
+//!
+//! \code
+//! node::ChunkReader reader(dataset);
+//! std::vector<unsigned short> frames(nframes*ny*nx);
+//! reader.read(frames);
+//! \endcode
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+class DLL_EXPORT ChunkReader
+{
+  public:
+    //!
+    //! \brief constructor
+    //!
+    //! \throws std::runtime_error if the dataset is not chunked, uses a
+    //!         variable length type or a filter which is not supported by
+    //!         filter::FilterPipeline
+    //! \param dataset the dataset to read from
+    //! \param threads number of decompression threads - if 0 the number of
+    //!                hardware threads is used
+    //!
+    ChunkReader(const Dataset &dataset,size_t threads = 0);
+
+    //!
+    //! \brief destructor
+    //!
+    ~ChunkReader();
+
+    ChunkReader(const ChunkReader &) = delete;
+    ChunkReader &operator=(const ChunkReader &) = delete;
+
+    //!
+    //! \brief get the dataset
+    //!
+    const Dataset &dataset() const noexcept;
+
+    //!
+    //! \brief number of decompression threads
+    //!
+    size_t threads() const noexcept;
+
+    //!
+    //! \brief read the entire dataset
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \tparam T destination type
+    //! \param data reference to the destination instance
+    //! \param dtpl reference to a dataset transfer property list
+    //!
+    template<typename T>
+    void read(T &data,const property::DatasetTransferList &dtpl =
+                          property::DatasetTransferList::get()) const;
+
+    //!
+    //! \brief read a block of data
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \tparam T destination type
+    //! \param data reference to the destination instance
+    //! \param selection hyperslab describing the block in the dataset
+    //! \param dtpl reference to a dataset transfer property list
+    //!
+    template<typename T>
+    void read(T &data,const dataspace::Hyperslab &selection,
+              const property::DatasetTransferList &dtpl =
+                  property::DatasetTransferList::get()) const;
+
+    //!
+    //! \brief read a block of raw data
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param data pointer to memory for the block elements in row-major
+    //!             order
+    //! \param offset offset of the block in the dataset
+    //! \param block number of elements of the block along each dimension
+    //! \param dtpl reference to a dataset transfer property list
+    //!
+    void read(void *data,const Dimensions &offset,const Dimensions &block,
+              const property::DatasetTransferList &dtpl =
+                  property::DatasetTransferList::get()) const;
+
+  private:
+    Dataset dataset_;
+    datatype::Datatype file_type_;
+    Dimensions chunk_dims_;
+    size_t element_size_;
+    filter::FilterPipeline pipeline_;
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+    filter::FilterPipeline::Buffer fill_value_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+    std::unique_ptr<ThreadPool> pool_;
+
+    void check_memory(const datatype::Datatype &mem_type,
+                      const dataspace::Dataspace &mem_space,
+                      size_t elements) const;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+template<typename T>
+void ChunkReader::read(T &data,const property::DatasetTransferList &dtpl) const
+{
+  Dimensions dims = concurrency::Executor::instance().run([this]()
+  { return dataspace::Simple(dataset_.dataspace()).current_dimensions(); });
+  read(data,dataspace::Hyperslab(Dimensions(dims.size(),0),dims),dtpl);
+}
+
+template<typename T>
+void ChunkReader::read(T &data,const dataspace::Hyperslab &selection,
+                       const property::DatasetTransferList &dtpl) const
+{
+  for(size_t d = 0; d < selection.rank(); ++d)
+  {
+    if(selection.count()[d] != 1 && selection.stride()[d] != selection.block()[d])
+    {
+      throw std::runtime_error("ChunkReader requires a contiguous hyperslab selection!");
+    }
+  }
+
+  concurrency::Executor::instance().run([&]()
+  {
+    datatype::DatatypeHolder mem_type_holder;
+    dataspace::DataspaceHolder mem_space_holder;
+    check_memory(mem_type_holder.get(data),mem_space_holder.get(data),
+                 selection.size());
+  });
+
+  read(dataspace::ptr(data),selection.offset(),selection.dimensions(),dtpl);
+}
+
+#endif
+
+} // namespace node
+} // namespace hdf5
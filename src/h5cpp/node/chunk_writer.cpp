@@ -0,0 +1,174 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <sstream>
+#include <stdexcept>
+#include <h5cpp/core/executor.hpp>
+#include <h5cpp/dataspace/simple.hpp>
+#include <h5cpp/node/chunk_grid.hpp>
+#include <h5cpp/node/chunk_writer.hpp>
+
+namespace hdf5 {
+namespace node {
+
+namespace {
+
+Dimensions chunk_dimensions(const Dataset &dataset)
+{
+  auto dcpl = dataset.creation_list();
+  if(dcpl.layout() != property::DatasetLayout::Chunked)
+  {
+    std::stringstream ss;
+    ss<<"Dataset ["<<dataset.link().path()<<"] is not chunked!";
+    throw std::runtime_error(ss.str());
+  }
+  return dcpl.chunk();
+}
+
+datatype::Datatype fixed_size_type(const Dataset &dataset)
+{
+  auto type = dataset.datatype();
+  if(!datatype::is_fixed_size(type))
+  {
+    std::stringstream ss;
+    ss<<"Dataset ["<<dataset.link().path()<<"] has a variable length type"
+      <<" which cannot be written chunk by chunk!";
+    throw std::runtime_error(ss.str());
+  }
+  return type;
+}
+
+struct EncodedChunk
+{
+  filter::FilterPipeline::Buffer data;
+  std::uint32_t filter_mask;
+};
+
+} // anonymous namespace
+
+ChunkWriter::ChunkWriter(const Dataset &dataset,size_t threads):
+    dataset_(dataset),
+    file_type_(fixed_size_type(dataset)),
+    chunk_dims_(chunk_dimensions(dataset)),
+    element_size_(file_type_.size()),
+    pipeline_(dataset.creation_list(),element_size_),
+    pool_(new ThreadPool(threads))
+{}
+
+ChunkWriter::~ChunkWriter()
+{}
+
+const Dataset &ChunkWriter::dataset() const noexcept
+{
+  return dataset_;
+}
+
+size_t ChunkWriter::threads() const noexcept
+{
+  return pool_->size();
+}
+
+void ChunkWriter::write(const void *data,const Dimensions &offset,
+                        const Dimensions &block,
+                        const property::DatasetTransferList &dtpl) const
+{
+  auto &executor = concurrency::Executor::instance();
+  Dimensions dims = executor.run([this]()
+  { return dataspace::Simple(dataset_.dataspace()).current_dimensions(); });
+  if(offset.size() != dims.size() || block.size() != dims.size())
+  {
+    std::stringstream ss;
+    ss<<"Rank of block does not match the rank of dataset ["
+      <<dataset_.link().path()<<"]!";
+    throw std::runtime_error(ss.str());
+  }
+
+  for(size_t d = 0; d < dims.size(); ++d)
+  {
+    hsize_t end = offset[d] + block[d];
+    if(end > dims[d])
+    {
+      std::stringstream ss;
+      ss<<"Block exceeds the extent of dataset ["<<dataset_.link().path()
+        <<"] along dimension "<<d<<"!";
+      throw std::runtime_error(ss.str());
+    }
+    // chunks are written as a whole - only chunks crossing the extent of
+    // the dataset may be partially covered
+    if(offset[d] % chunk_dims_[d] != 0 ||
+       (end % chunk_dims_[d] != 0 && end != dims[d]))
+    {
+      std::stringstream ss;
+      ss<<"Block is not aligned to the chunks of dataset ["
+        <<dataset_.link().path()<<"] along dimension "<<d<<"!";
+      throw std::runtime_error(ss.str());
+    }
+  }
+
+  ChunkGrid grid(chunk_dims_,offset,block);
+  size_t chunk_size = grid.chunk_elements() * element_size_;
+
+  auto encode = [&](size_t index)
+  {
+    EncodedChunk chunk{filter::FilterPipeline::Buffer(chunk_size,0),0};
+    grid.gather(data,index,chunk.data.data(),element_size_);
+    chunk.filter_mask = pipeline_.encode(chunk.data);
+    return chunk;
+  };
+
+  // limit the number of encoded chunks held in memory
+  const size_t window = 2 * pool_->size();
+  std::deque<std::future<EncodedChunk>> encoded;
+  size_t next = 0;
+  try
+  {
+    for(size_t index = 0; index < grid.size(); ++index)
+    {
+      for(; next < grid.size() && next < index + window; ++next)
+        encoded.push_back(pool_->submit([&encode,next]() { return encode(next); }));
+
+      EncodedChunk chunk = encoded.front().get();
+      encoded.pop_front();
+
+      executor.run([&]()
+      {
+        dataset_.write_chunk(chunk.data.data(),chunk.data.size(),
+                             grid.chunk_offset(index),chunk.filter_mask,dtpl);
+      });
+    }
+  }
+  catch(...)
+  {
+    // the tasks still refer to the source buffer
+    for(auto &chunk: encoded)
+      chunk.wait();
+    throw;
+  }
+}
+
+} // namespace node
+} // namespace hdf5
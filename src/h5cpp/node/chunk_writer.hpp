@@ -0,0 +1,181 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <h5cpp/core/executor.hpp>
+#include <h5cpp/core/thread_pool.hpp>
+#include <h5cpp/core/types.hpp>
+#include <h5cpp/core/utilities.hpp>
+#include <h5cpp/core/windows.hpp>
+#include <h5cpp/dataspace/hyperslab.hpp>
+#include <h5cpp/dataspace/type_trait.hpp>
+#include <h5cpp/datatype/factory.hpp>
+#include <h5cpp/filter/pipeline.hpp>
+#include <h5cpp/node/dataset.hpp>
+#include <h5cpp/property/dataset_transfer.hpp>
+
+namespace hdf5 {
+namespace node {
+
+//!
+//! \brief parallel chunk compression and direct chunk writing
+//!
+//! A ChunkWriter writes a block of raw elements to a chunked dataset by
+//! splitting it along the chunk grid of the dataset, encoding the chunks
+//! with the dataset's filters on a pool of worker threads and committing
+//! them in order via direct chunk write. Compared to a normal write, where
+//! libhdf5 runs the filters for one chunk after the other on the calling
+//! thread, the compression throughput scales with the number of threads.
+//!
+//! The filters are applied by filter::FilterPipeline. The block must start
+//! at a chunk boundary and cover whole chunks - except for chunks crossing
+//! the current extent of the dataset which are padded with zeros. The
+//! elements must be stored in memory exactly as they are stored in the file
+//! as no type conversion is performed.
+//!
+//! The HDF5 calls of write() are made via concurrency::Executor.
+//!
+//! \code
+//! node::ChunkWriter writer(dataset);
+//! dataset.extent(0,frames_per_block);
+//! writer.write(frames,dataspace::Hyperslab{{offset,0,0},{frames_per_block,ny,nx}});
+//! \endcode
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+class DLL_EXPORT ChunkWriter
+{
+  public:
+    //!
+    //! \brief constructor
+    //!
+    //! \throws std::runtime_error if the dataset is not chunked, uses a
+    //!         variable length type or a filter which is not supported by
+    //!         filter::FilterPipeline
+    //! \param dataset the dataset to write to
+    //! \param threads number of compression threads - if 0 the number of
+    //!                hardware threads is used
+    //!
+    ChunkWriter(const Dataset &dataset,size_t threads = 0);
+
+    //!
+    //! \brief destructor
+    //!
+    ~ChunkWriter();
+
+    ChunkWriter(const ChunkWriter &) = delete;
+    ChunkWriter &operator=(const ChunkWriter &) = delete;
+
+    //!
+    //! \brief get the dataset
+    //!
+    const Dataset &dataset() const noexcept;
+
+    //!
+    //! \brief number of compression threads
+    //!
+    size_t threads() const noexcept;
+
+    //!
+    //! \brief write a block of data
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \tparam T source type
+    //! \param data reference to the source instance
+    //! \param selection hyperslab describing the block in the dataset
+    //! \param dtpl reference to a dataset transfer property list
+    //!
+    template<typename T>
+    void write(const T &data,const dataspace::Hyperslab &selection,
+               const property::DatasetTransferList &dtpl =
+                   property::DatasetTransferList::get()) const;
+
+    //!
+    //! \brief write a block of raw data
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param data pointer to the block elements in row-major order
+    //! \param offset offset of the block in the dataset
+    //! \param block number of elements of the block along each dimension
+    //! \param dtpl reference to a dataset transfer property list
+    //!
+    void write(const void *data,const Dimensions &offset,
+               const Dimensions &block,
+               const property::DatasetTransferList &dtpl =
+                   property::DatasetTransferList::get()) const;
+
+  private:
+    Dataset dataset_;
+    datatype::Datatype file_type_;
+    Dimensions chunk_dims_;
+    size_t element_size_;
+    filter::FilterPipeline pipeline_;
+    std::unique_ptr<ThreadPool> pool_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+template<typename T>
+void ChunkWriter::write(const T &data,const dataspace::Hyperslab &selection,
+                        const property::DatasetTransferList &dtpl) const
+{
+  for(size_t d = 0; d < selection.rank(); ++d)
+  {
+    if(selection.count()[d] != 1 && selection.stride()[d] != selection.block()[d])
+    {
+      throw std::runtime_error("ChunkWriter requires a contiguous hyperslab selection!");
+    }
+  }
+
+  concurrency::Executor::instance().run([&]()
+  {
+    datatype::DatatypeHolder mem_type_holder;
+    dataspace::DataspaceHolder mem_space_holder;
+    if(mem_type_holder.get(data) != file_type_)
+    {
+      std::stringstream ss;
+      ss<<"Memory type does not match the file type of dataset ["
+        <<dataset_.link().path()<<"] - ChunkWriter does not convert types!";
+      throw std::runtime_error(ss.str());
+    }
+    if(signed2unsigned<size_t>(mem_space_holder.get(data).size()) != selection.size())
+    {
+      std::stringstream ss;
+      ss<<"Number of elements in memory ("<<mem_space_holder.get(data).size()
+        <<") does not match the size of the selection ("<<selection.size()<<")!";
+      throw std::runtime_error(ss.str());
+    }
+  });
+
+  write(dataspace::cptr(data),selection.offset(),selection.dimensions(),dtpl);
+}
+
+} // namespace node
+} // namespace hdf5
@@ -26,12 +26,15 @@
 // Created on: Sep 12, 2017
 //
 
+#include <algorithm>
 #include <cstdlib>
 #include <sstream>
 #include <stdexcept>
 #include <h5cpp/node/dataset.hpp>
 #include <h5cpp/node/functions.hpp>
 #include <h5cpp/filter/external_filter.hpp>
+#include <h5cpp/dataspace/simple.hpp>
+#include <h5cpp/property/file_access.hpp>
 #include <h5cpp/error/error.hpp>
 #include <h5cpp/contrib/stl/string.hpp>
 #include <h5cpp/core/utilities.hpp>
@@ -88,6 +91,8 @@ Dataset::Dataset(const Node &node):
   }
   file_type_ = datatype();
   file_type_class = file_type_.get_class();
+  file_type_variable_string = file_type_class == datatype::Class::String &&
+                              datatype::String(file_type_).is_variable_length();
 }
 
 Dataset::Dataset(const Group &base,const Path &path,
@@ -100,6 +105,8 @@ Dataset::Dataset(const Group &base,const Path &path,
   {
   file_type_ = datatype();
   file_type_class = file_type_.get_class();
+  file_type_variable_string = file_type_class == datatype::Class::String &&
+                              datatype::String(file_type_).is_variable_length();
 }
 
 
@@ -189,8 +196,73 @@ void Dataset::refresh() const
 #endif
 
 
+void Dataset::write_chunk(const void *data,
+                          size_t size,
+                          std::vector<hsize_t> offset,
+                          std::uint32_t filter_mask,
+                          const property::DatasetTransferList &dtpl) const
+{
+#if H5_VERSION_GE(1,10,3)
+  if(H5Dwrite_chunk(static_cast<hid_t>(*this),
+                    static_cast<hid_t>(dtpl),
+                    filter_mask,
+                    offset.data(),
+                    size,
+                    data)<0)
+#else
+  if(H5DOwrite_chunk(static_cast<hid_t>(*this),
+                     static_cast<hid_t>(dtpl),
+                     filter_mask,
+                     offset.data(),
+                     size,
+                     data)<0)
+#endif
+    {
+      std::stringstream ss;
+      ss<<"Failure to write chunk data to dataset ["<<link().path()<<"]!";
+      error::Singleton::instance().throw_with_stack(ss.str());
+    }
+}
+
 #if H5_VERSION_GE(1,10,2)
 
+std::uint32_t Dataset::read_chunk(void *data,
+                                  size_t size,
+                                  std::vector<hsize_t> offset,
+                                  const property::DatasetTransferList &dtpl) const
+{
+  // libhdf5 writes the entire chunk without knowing the size of the buffer
+  hsize_t storage_size = chunk_storage_size(offset);
+  if(storage_size > size)
+    {
+      std::stringstream ss;
+      ss<<"Buffer of "<<size<<" bytes is too small for chunk of "<<storage_size
+        <<" bytes of dataset ["<<link().path()<<"]!";
+      throw std::runtime_error(ss.str());
+    }
+
+  std::uint32_t filter_mask = 0;
+#if H5_VERSION_GE(1,10,3)
+  if(H5Dread_chunk(static_cast<hid_t>(*this),
+                   static_cast<hid_t>(dtpl),
+                   offset.data(),
+                   &filter_mask,
+                   data)<0)
+#else
+  if(H5DOread_chunk(static_cast<hid_t>(*this),
+                    static_cast<hid_t>(dtpl),
+                    offset.data(),
+                    &filter_mask,
+                    data)<0)
+#endif
+    {
+      std::stringstream ss;
+      ss<<"Failure to read chunk data from dataset ["<<link().path()<<"]!";
+      error::Singleton::instance().throw_with_stack(ss.str());
+    }
+  return filter_mask;
+}
+
 hsize_t Dataset::chunk_storage_size(
 			 std::vector<hsize_t> offset) const
 {
@@ -208,6 +280,131 @@ hsize_t Dataset::chunk_storage_size(
 
 #endif
 
+#if H5_VERSION_GE(1,10,5)
+
+namespace {
+
+#if H5_VERSION_GE(1,14,1)
+struct ChunkCollector
+{
+  size_t rank;
+  std::vector<ChunkInfo> chunks;
+};
+
+int collect_chunk(const hsize_t *offset,unsigned filter_mask,haddr_t address,
+                  hsize_t size,void *op_data)
+{
+  auto collector = static_cast<ChunkCollector*>(op_data);
+  collector->chunks.push_back(ChunkInfo{Dimensions(offset,offset+collector->rank),
+                                        filter_mask,address,size});
+  return 0;
+}
+#endif
+
+ChunkInfo indexed_chunk_info(const Dataset &dataset,
+                             const dataspace::Simple &space,size_t index)
+{
+  ChunkInfo info{Dimensions(space.rank()),0,HADDR_UNDEF,0};
+  unsigned filter_mask = 0;
+  if(H5Dget_chunk_info(static_cast<hid_t>(dataset),
+                       static_cast<hid_t>(space),
+                       index,
+                       info.offset.data(),
+                       &filter_mask,
+                       &info.address,
+                       &info.size)<0)
+    {
+      std::stringstream ss;
+      ss<<"Failure to retrieve chunk information from dataset ["
+        <<dataset.link().path()<<"]!";
+      error::Singleton::instance().throw_with_stack(ss.str());
+    }
+  info.filter_mask = filter_mask;
+  return info;
+}
+
+} // anonymous namespace
+
+size_t Dataset::chunk_count() const
+{
+  // not all versions of libhdf5 accept H5S_ALL here
+  hsize_t count = 0;
+  if(H5Dget_num_chunks(static_cast<hid_t>(*this),
+                       static_cast<hid_t>(dataspace()),
+                       &count)<0)
+    {
+      std::stringstream ss;
+      ss<<"Failure to retrieve the number of chunks of dataset ["<<link().path()<<"]!";
+      error::Singleton::instance().throw_with_stack(ss.str());
+    }
+  return static_cast<size_t>(count);
+}
+
+ChunkInfo Dataset::chunk_info(const Dimensions &offset) const
+{
+  if(offset.size() != dataspace::Simple(dataspace()).rank())
+    {
+      std::stringstream ss;
+      ss<<"Chunk offset does not match the rank of dataset ["<<link().path()<<"]!";
+      throw std::runtime_error(ss.str());
+    }
+
+  ChunkInfo info{offset,0,HADDR_UNDEF,0};
+  unsigned filter_mask = 0;
+  if(H5Dget_chunk_info_by_coord(static_cast<hid_t>(*this),
+                                offset.data(),
+                                &filter_mask,
+                                &info.address,
+                                &info.size)<0)
+    {
+      std::stringstream ss;
+      ss<<"Failure to retrieve chunk information from dataset ["<<link().path()<<"]!";
+      error::Singleton::instance().throw_with_stack(ss.str());
+    }
+  info.filter_mask = filter_mask;
+  return info;
+}
+
+ChunkInfo Dataset::chunk_info_by_index(size_t index) const
+{
+  // libhdf5 does not check the index
+  size_t count = chunk_count();
+  if(index >= count)
+    {
+      std::stringstream ss;
+      ss<<"Chunk index "<<index<<" exceeds the number of chunks ("<<count
+        <<") of dataset ["<<link().path()<<"]!";
+      throw std::runtime_error(ss.str());
+    }
+
+  return indexed_chunk_info(*this,dataspace::Simple(dataspace()),index);
+}
+
+std::vector<ChunkInfo> Dataset::chunks() const
+{
+#if H5_VERSION_GE(1,14,1)
+  // 1.14.0 reports the offsets in units of chunks
+  ChunkCollector collector{dataspace::Simple(dataspace()).rank(),{}};
+  if(H5Dchunk_iter(static_cast<hid_t>(*this),H5P_DEFAULT,collect_chunk,&collector)<0)
+    {
+      std::stringstream ss;
+      ss<<"Failure to iterate over the chunks of dataset ["<<link().path()<<"]!";
+      error::Singleton::instance().throw_with_stack(ss.str());
+    }
+  return collector.chunks;
+#else
+  dataspace::Simple space(dataspace());
+  std::vector<ChunkInfo> chunks;
+  size_t count = chunk_count();
+  chunks.reserve(count);
+  for(size_t index = 0; index < count; ++index)
+    chunks.push_back(indexed_chunk_info(*this,space,index));
+  return chunks;
+#endif
+}
+
+#endif
+
 void Dataset::write(const char *data,const property::DatasetTransferList &dtpl)
 {
   write(std::string(data),dtpl);
@@ -218,6 +415,138 @@ void Dataset::write(const char *data,const property::DatasetTransferList &dtpl)
   write(std::string(data),dtpl);
 }
 
+void Dataset::read(std::vector<std::string_view> &data,StringArena &arena,
+                   const property::DatasetTransferList &dtpl) const
+{
+  auto file_space = dataspace();
+  file_space.selection.all();
+  read_string_views(data,arena,file_space,dtpl);
+}
+
+void Dataset::read(std::vector<std::string_view> &data,StringArena &arena,
+                   const dataspace::Selection &selection,
+                   const property::DatasetTransferList &dtpl) const
+{
+  auto file_space = dataspace();
+  file_space.selection(dataspace::SelectionOperation::Set,selection);
+  read_string_views(data,arena,file_space,dtpl);
+}
+
+void Dataset::read_string_views(std::vector<std::string_view> &data,
+                                StringArena &arena,
+                                const dataspace::Dataspace &file_space,
+                                const property::DatasetTransferList &dtpl) const
+{
+  if(!file_type_variable_string)
+  {
+    std::stringstream ss;
+    ss<<"Dataset ["<<link().path()<<"] does not store variable length strings!";
+    throw std::runtime_error(ss.str());
+  }
+
+  size_t size = file_space.selection.size();
+  data.resize(size);
+  if(size == 0)
+    return;
+
+  const auto &mem_type = datatype::TypeCache::instance().variable_string(
+      datatype::String(file_type_).encoding());
+  dataspace::Simple mem_space{{static_cast<hsize_t>(size)}};
+
+  // a private copy of the transfer list carries the arena
+  property::DatasetTransferList arena_dtpl(
+      ObjectHandle(H5Pcopy(static_cast<hid_t>(dtpl))));
+  arena.install(static_cast<hid_t>(arena_dtpl));
+
+  VarLengthStringBuffer<char> buffer(size);
+  if(H5Dread(static_cast<hid_t>(*this),
+             static_cast<hid_t>(mem_type),
+             static_cast<hid_t>(mem_space),
+             static_cast<hid_t>(file_space),
+             static_cast<hid_t>(arena_dtpl),
+             buffer.data())<0)
+  {
+    std::stringstream ss;
+    ss<<"Failure to read variable length string data from dataset ["
+      <<link().path()<<"]!";
+    error::Singleton::instance().throw_with_stack(ss.str());
+  }
+
+  std::transform(buffer.begin(),buffer.end(),data.begin(),
+                 [](const char *ptr)
+                 {
+                   return ptr ? std::string_view(ptr) : std::string_view();
+                 });
+}
+
+void Dataset::read_fields_data(void *data,const datatype::Compound &mem_type,
+                               const dataspace::Dataspace &file_space) const
+{
+  check_fields(mem_type);
+
+  size_t size = file_space.selection.size();
+  if(size == 0)
+    return;
+
+  dataspace::Simple mem_space{{static_cast<hsize_t>(size)}};
+  if(H5Dread(static_cast<hid_t>(*this),
+             static_cast<hid_t>(mem_type),
+             static_cast<hid_t>(mem_space),
+             static_cast<hid_t>(file_space),
+             static_cast<hid_t>(property::DatasetTransferList::get()),
+             data)<0)
+  {
+    std::stringstream ss;
+    ss<<"Failure to read compound fields from dataset ["<<link().path()<<"]!";
+    error::Singleton::instance().throw_with_stack(ss.str());
+  }
+}
+
+void Dataset::write_fields_data(const void *data,const datatype::Compound &mem_type,
+                                const dataspace::Dataspace &file_space) const
+{
+  check_fields(mem_type);
+
+  size_t size = file_space.selection.size();
+  if(size == 0)
+    return;
+
+  dataspace::Simple mem_space{{static_cast<hsize_t>(size)}};
+  if(H5Dwrite(static_cast<hid_t>(*this),
+              static_cast<hid_t>(mem_type),
+              static_cast<hid_t>(mem_space),
+              static_cast<hid_t>(file_space),
+              static_cast<hid_t>(property::DatasetTransferList::get()),
+              data)<0)
+  {
+    std::stringstream ss;
+    ss<<"Failure to write compound fields to dataset ["<<link().path()<<"]!";
+    error::Singleton::instance().throw_with_stack(ss.str());
+  }
+}
+
+void Dataset::check_fields(const datatype::Compound &mem_type) const
+{
+  if(file_type_class != datatype::Class::Compound)
+  {
+    std::stringstream ss;
+    ss<<"Dataset ["<<link().path()<<"] does not store compound data!";
+    throw std::runtime_error(ss.str());
+  }
+
+  hid_t file_type = static_cast<hid_t>(file_type_);
+  for(size_t index = 0; index < mem_type.number_of_fields(); ++index)
+  {
+    std::string name = mem_type.field_name(index);
+    if(H5Tget_member_index(file_type,name.c_str()) < 0)
+    {
+      std::stringstream ss;
+      ss<<"Dataset ["<<link().path()<<"] has no field ["<<name<<"]!";
+      throw std::runtime_error(ss.str());
+    }
+  }
+}
+
 filter::ExternalFilters Dataset::filters() const
 {
   filter::ExternalFilters efilters = filter::ExternalFilters();
@@ -225,6 +554,50 @@ filter::ExternalFilters Dataset::filters() const
   return efilters;
 }
 
+DatasetMapping Dataset::map() const
+{
+  auto dcpl = creation_list();
+  if(dcpl.layout() != property::DatasetLayout::Contiguous ||
+     H5Pget_external_count(static_cast<hid_t>(dcpl)) != 0)
+    {
+      std::stringstream ss;
+      ss<<"Only datasets with contiguous layout stored in the file can be"
+        <<" mapped - dataset ["<<link().path()<<"] cannot!";
+      throw std::runtime_error(ss.str());
+    }
+  if(!datatype::is_fixed_size(file_type_))
+    {
+      std::stringstream ss;
+      ss<<"Dataset ["<<link().path()<<"] with variable length type cannot be mapped!";
+      throw std::runtime_error(ss.str());
+    }
+
+  // the data must be located in a single file on disk
+  const file::File &file = link().file();
+  property::FileAccessList fapl(ObjectHandle(H5Fget_access_plist(static_cast<hid_t>(file))));
+  if(H5Pget_driver(static_cast<hid_t>(fapl)) != H5FD_SEC2)
+    {
+      std::stringstream ss;
+      ss<<"Dataset ["<<link().path()<<"] can only be mapped from files using"
+        <<" the POSIX driver!";
+      throw std::runtime_error(ss.str());
+    }
+  file.flush(file::Scope::Local);
+
+  haddr_t offset = H5Dget_offset(static_cast<hid_t>(*this));
+  if(offset == HADDR_UNDEF)
+    {
+      std::stringstream ss;
+      ss<<"No storage allocated for dataset ["<<link().path()<<"]!";
+      throw std::runtime_error(ss.str());
+    }
+
+  dataspace::Simple space(dataspace());
+  return DatasetMapping(file.path(),offset,
+                        static_cast<size_t>(H5Dget_storage_size(static_cast<hid_t>(*this))),
+                        space.current_dimensions(),file_type_);
+}
+
 void resize_by(const Dataset &dataset,size_t dimension_index,ssize_t delta)
 {
   dataspace::Dataspace space = dataset.dataspace();
@@ -28,14 +28,19 @@
 #pragma once
 
 #include <h5cpp/node/node.hpp>
+#include <h5cpp/node/chunk_info.hpp>
+#include <h5cpp/node/dataset_mapping.hpp>
 #include <h5cpp/dataspace/dataspace.hpp>
 #include <h5cpp/dataspace/hyperslab.hpp>
 #include <h5cpp/datatype/datatype.hpp>
+#include <h5cpp/datatype/compound.hpp>
+#include <h5cpp/datatype/type_cache.hpp>
 #include <h5cpp/dataspace/pool.hpp>
 #include <h5cpp/property/dataset_transfer.hpp>
 #include <h5cpp/core/types.hpp>
 #include <h5cpp/core/variable_length_string.hpp>
 #include <h5cpp/core/fixed_length_string.hpp>
+#include <h5cpp/core/string_arena.hpp>
 #include <h5cpp/core/windows.hpp>
 #include <h5cpp/property/link_creation.hpp>
 #include <h5cpp/property/dataset_creation.hpp>
@@ -43,6 +48,10 @@
 #include <h5cpp/filter/external_filter.hpp>
 #include <h5cpp/contrib/stl/string.hpp>
 #include <h5cpp/error/error.hpp>
+#include <cstring>
+#include <string_view>
+#include <tuple>
+#include <typeindex>
 #include <vector>
 #include <h5cpp/core/utilities.hpp>
 
@@ -50,6 +59,8 @@ namespace hdf5 {
 namespace node {
 
 class Selection;
+template<typename T> class PreparedWrite;
+template<typename T> class PreparedRead;
 
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -373,12 +384,36 @@ class DLL_EXPORT Dataset : public Node
 		     const property::DatasetTransferList &dtpl =
 		     property::DatasetTransferList::get())  const;
 
+    //!
+    //! \brief write raw dataset chunk
+    //!
+    //! Write a chunk from a raw memory buffer. The buffer is passed to the
+    //! file as is - it must hold the chunk exactly as it should be stored
+    //! (for instance already compressed with the filters not set in the
+    //! filter mask).
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param data pointer to the chunk data
+    //! \param size size of the chunk data in bytes
+    //! \param offset logical position of the first element of the chunk in the dataset's dataspace
+    //! \param filter_mask mask of which filters are used with the chunk
+    //! \param dtpl reference to a dataset transfer property list
+    //!
+    void write_chunk(const void *data,
+                     size_t size,
+                     std::vector<hsize_t> offset,
+                     std::uint32_t filter_mask = 0,
+                     const property::DatasetTransferList &dtpl =
+                     property::DatasetTransferList::get()) const;
+
 #if (defined(_DOXYGEN_) || H5_VERSION_GE(1,10,2))
 
     //!
     //! \brief read dataset chunk  (*since hdf5 1.10.2*)
     //!
-    //! Read a chunk from a dataset to an instance of T.
+    //! Read a chunk from a dataset to an instance of T. The chunk is
+    //! copied as stored in the file (with all filters still applied), thus
+    //! the memory type must be a fixed size type.
     //!
     //! \throws std::runtime_error in case of a failure
     //! \tparam T source type
@@ -397,7 +432,9 @@ class DLL_EXPORT Dataset : public Node
     //!
     //! \brief read dataset chunk
     //!
-    //! Read a chunk from a dataset to an instance of T.
+    //! Read a chunk from a dataset to an instance of T. The chunk is
+    //! copied as stored in the file (with all filters still applied), thus
+    //! the memory type must be a fixed size type.
     //!
     //! \throws std::runtime_error in case of a failure
     //! \tparam T source type
@@ -414,6 +451,26 @@ class DLL_EXPORT Dataset : public Node
 			       const property::DatasetTransferList &dtpl =
 			       property::DatasetTransferList::get())  const;
 
+    //!
+    //! \brief read raw dataset chunk  (*since hdf5 1.10.2*)
+    //!
+    //! Read a chunk as stored in the file (with all filters still applied)
+    //! to a raw memory buffer.
+    //!
+    //! \throws std::runtime_error in case of a failure or if the buffer is
+    //!                            too small for the chunk
+    //! \param data pointer to the memory for the chunk data
+    //! \param size size of the memory buffer in bytes
+    //! \param offset logical position of the first element of the chunk in the dataset's dataspace
+    //! \param dtpl reference to a dataset transfer property list
+    //! \return filter_mask mask of which filters are used with the chunk
+    //!
+    std::uint32_t read_chunk(void *data,
+                             size_t size,
+                             std::vector<hsize_t> offset,
+                             const property::DatasetTransferList &dtpl =
+                             property::DatasetTransferList::get()) const;
+
 
     //!
     //! \brief read dataset chunk
@@ -426,6 +483,56 @@ class DLL_EXPORT Dataset : public Node
     //!
       hsize_t chunk_storage_size(std::vector<hsize_t> offset)  const;
 
+#endif
+
+#if (defined(_DOXYGEN_) || H5_VERSION_GE(1,10,5))
+
+    //!
+    //! \brief number of allocated chunks  (*since hdf5 1.10.5*)
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \return the number of chunks with storage allocated in the file
+    //!
+    size_t chunk_count() const;
+
+    //!
+    //! \brief get chunk storage information  (*since hdf5 1.10.5*)
+    //!
+    //! Unlike chunk_storage_size() this does not fail for chunks which
+    //! have not been written yet. For those ChunkInfo::is_allocated()
+    //! returns false.
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param offset logical position of the first element of the chunk in the dataset's dataspace
+    //! \return storage information of the chunk
+    //!
+    ChunkInfo chunk_info(const Dimensions &offset) const;
+
+    //!
+    //! \brief get chunk storage information by index  (*since hdf5 1.10.5*)
+    //!
+    //! \throws std::runtime_error in case of a failure or if the index
+    //!                            exceeds the number of allocated chunks
+    //! \param index index of the chunk in the chunk index of the dataset
+    //! \return storage information of the chunk
+    //! \sa chunk_count()
+    //!
+    ChunkInfo chunk_info_by_index(size_t index) const;
+
+    //!
+    //! \brief get storage information of all chunks  (*since hdf5 1.10.5*)
+    //!
+    //! Returns the information of all allocated chunks in the order of the
+    //! chunk index of the dataset. Sorting the result by
+    //! ChunkInfo::address yields the order in which the chunks are stored
+    //! in the file. Uses a single pass over the chunk index with
+    //! \c H5Dchunk_iter where available.
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \return storage information of all allocated chunks
+    //!
+    std::vector<ChunkInfo> chunks() const;
+
 #endif
 
     //!
@@ -549,6 +656,44 @@ class DLL_EXPORT Dataset : public Node
               const dataspace::Selection &file_selection,
               const property::DatasetTransferList &dtpl = property::DatasetTransferList::get()) const;
 
+    //!
+    //! \brief read variable length strings into an arena
+    //!
+    //! Reads all strings of a variable length string dataset. libhdf5
+    //! allocates the strings from the arena instead of the heap and the
+    //! strings are returned as views into the arena. Nothing has to be
+    //! reclaimed - the memory is released with the arena. This avoids two
+    //! heap operations per string compared to reading std::string.
+    //!
+    //! The views are valid until the arena is cleared or destroyed. The
+    //! vector is resized to the number of strings read. Null strings are
+    //! returned as empty views.
+    //!
+    //! \throws std::runtime_error if the dataset is not a variable length
+    //!         string dataset or reading fails
+    //! \param data vector receiving the string views
+    //! \param arena the arena holding the strings
+    //! \param dtpl reference to a dataset transfer property list
+    //!
+    void read(std::vector<std::string_view> &data,StringArena &arena,
+              const property::DatasetTransferList &dtpl =
+                  property::DatasetTransferList::get()) const;
+
+    //!
+    //! \brief read a selection of variable length strings into an arena
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param data vector receiving the string views
+    //! \param arena the arena holding the strings
+    //! \param selection the selection of the strings to read
+    //! \param dtpl reference to a dataset transfer property list
+    //! \sa read(std::vector<std::string_view>&,StringArena&,const property::DatasetTransferList&)
+    //!
+    void read(std::vector<std::string_view> &data,StringArena &arena,
+              const dataspace::Selection &selection,
+              const property::DatasetTransferList &dtpl =
+                  property::DatasetTransferList::get()) const;
+
     //!
     //! \brief get the dataset external filters for the instance
     //!
@@ -560,9 +705,155 @@ class DLL_EXPORT Dataset : public Node
     //!
     filter::ExternalFilters filters() const;
 
+    //!
+    //! \brief map the dataset into memory
+    //!
+    //! Maps the storage of the dataset read-only into memory, see
+    //! DatasetMapping. This requires a dataset with contiguous layout whose
+    //! storage has already been allocated and which is located in a file
+    //! opened with the default POSIX driver. The file is flushed before
+    //! the dataset is mapped.
+    //!
+    //! \throws std::runtime_error if the dataset cannot be mapped
+    //! \return the memory mapping of the dataset
+    //!
+    DatasetMapping map() const;
+
+    //!
+    //! \brief prepare repeated writes to a selection
+    //!
+    //! Sets up memory type, memory space and file space once, see
+    //! PreparedWrite. Use this for writes in tight loops.
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \tparam T source type
+    //! \param selection the part of the dataset to write
+    //! \param dtpl reference to a dataset transfer property list
+    //! \return the prepared write operation
+    //!
+    template<typename T>
+    PreparedWrite<T> prepare_write(const dataspace::Hyperslab &selection,
+                                   const property::DatasetTransferList &dtpl =
+                                       property::DatasetTransferList::get()) const;
+
+    //!
+    //! \brief prepare repeated writes of the entire dataset
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \tparam T source type
+    //! \param dtpl reference to a dataset transfer property list
+    //! \return the prepared write operation
+    //!
+    template<typename T>
+    PreparedWrite<T> prepare_write(const property::DatasetTransferList &dtpl =
+                                       property::DatasetTransferList::get()) const;
+
+    //!
+    //! \brief prepare repeated reads from a selection
+    //!
+    //! Sets up memory type, memory space and file space once, see
+    //! PreparedRead. Use this for reads in tight loops.
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \tparam T destination type
+    //! \param selection the part of the dataset to read
+    //! \param dtpl reference to a dataset transfer property list
+    //! \return the prepared read operation
+    //!
+    template<typename T>
+    PreparedRead<T> prepare_read(const dataspace::Hyperslab &selection,
+                                 const property::DatasetTransferList &dtpl =
+                                     property::DatasetTransferList::get()) const;
+
+    //!
+    //! \brief prepare repeated reads of the entire dataset
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \tparam T destination type
+    //! \param dtpl reference to a dataset transfer property list
+    //! \return the prepared read operation
+    //!
+    template<typename T>
+    PreparedRead<T> prepare_read(const property::DatasetTransferList &dtpl =
+                                     property::DatasetTransferList::get()) const;
+
+    //!
+    //! \brief read fields of a compound dataset into separate vectors
+    //!
+    //! Reads only the named fields of every record and stores each field in
+    //! its own vector (struct of arrays). The memory type is a packed
+    //! compound type containing only the requested fields, so libhdf5
+    //! never converts or buffers the other fields. A single field is read
+    //! directly into its vector, several fields are read into one
+    //! temporary buffer and distributed afterwards. Every vector is resized
+    //! to the number of records.
+    //!
+    //! \code
+    //! std::vector<double> energy;
+    //! std::vector<std::uint64_t> timestamp;
+    //! dataset.read_fields({"energy","timestamp"},energy,timestamp);
+    //! \endcode
+    //!
+    //! \throws std::runtime_error if the dataset is not a compound, a field
+    //!         does not exist or reading fails
+    //! \tparam Ts element types of the fields
+    //! \param names the names of the fields, one for every vector
+    //! \param data the vectors receiving the fields
+    //!
+    template<typename ...Ts>
+    void read_fields(const std::vector<std::string> &names,
+                     std::vector<Ts> &...data) const;
+
+    //!
+    //! \brief read fields of a selection of compound records
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param names the names of the fields, one for every vector
+    //! \param selection the records to read
+    //! \param data the vectors receiving the fields
+    //! \sa read_fields(const std::vector<std::string>&,std::vector<Ts>&...)
+    //!
+    template<typename ...Ts>
+    void read_fields(const std::vector<std::string> &names,
+                     const dataspace::Selection &selection,
+                     std::vector<Ts> &...data) const;
+
+    //!
+    //! \brief write fields of a compound dataset from separate vectors
+    //!
+    //! Writes only the named fields of every record, the other fields are
+    //! left unchanged. All vectors must have one element for every record
+    //! of the dataset.
+    //!
+    //! \throws std::runtime_error if the dataset is not a compound, a field
+    //!         does not exist, the vector sizes do not match or writing
+    //!         fails
+    //! \tparam Ts element types of the fields
+    //! \param names the names of the fields, one for every vector
+    //! \param data the vectors providing the fields
+    //!
+    template<typename ...Ts>
+    void write_fields(const std::vector<std::string> &names,
+                      const std::vector<Ts> &...data) const;
+
+    //!
+    //! \brief write fields of a selection of compound records
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param names the names of the fields, one for every vector
+    //! \param selection the records to write
+    //! \param data the vectors providing the fields
+    //! \sa write_fields(const std::vector<std::string>&,const std::vector<Ts>&...)
+    //!
+    template<typename ...Ts>
+    void write_fields(const std::vector<std::string> &names,
+                      const dataspace::Selection &selection,
+                      const std::vector<Ts> &...data) const;
+
   private:
     datatype::Datatype file_type_;
     datatype::Class file_type_class;
+    bool file_type_variable_string = false;
     dataspace::DataspacePool space_pool;
     //!
     //! \brief static factory function for dataset creation
@@ -578,6 +869,35 @@ class DLL_EXPORT Dataset : public Node
                                const property::DatasetCreationList &dcpl,
                                const property::DatasetAccessList &dapl);
 
+    void read_string_views(std::vector<std::string_view> &data,
+                           StringArena &arena,
+                           const dataspace::Dataspace &file_space,
+                           const property::DatasetTransferList &dtpl) const;
+
+    //
+    // field IO for compound datasets
+    //
+    template<typename ...Ts>
+    static datatype::Compound fields_type(const std::vector<std::string> &names);
+
+    template<typename ...Ts>
+    void read_fields(const std::vector<std::string> &names,
+                     const dataspace::Dataspace &file_space,
+                     std::vector<Ts> &...data) const;
+
+    template<typename ...Ts>
+    void write_fields(const std::vector<std::string> &names,
+                      const dataspace::Dataspace &file_space,
+                      const std::vector<Ts> &...data) const;
+
+    void read_fields_data(void *data,const datatype::Compound &mem_type,
+                          const dataspace::Dataspace &file_space) const;
+
+    void write_fields_data(const void *data,const datatype::Compound &mem_type,
+                           const dataspace::Dataspace &file_space) const;
+
+    void check_fields(const datatype::Compound &mem_type) const;
+
     //
     // writing template methods for various data configurations
     //
@@ -811,7 +1131,7 @@ class DLL_EXPORT Dataset : public Node
 	  }
 
 	//get data out of the buffer
-	data = Trait::from_buffer(buffer,mem_type,mem_space);
+	Trait::from_buffer(buffer,mem_type,mem_space,data);
       }
     }
 };
@@ -831,8 +1151,7 @@ void Dataset::write(const T &data,const datatype::Datatype &mem_type,
   }
   else if(file_type_class == datatype::Class::String)
   {
-    datatype::String string_type(file_type_);
-    if(string_type.is_variable_length())
+    if(file_type_variable_string)
     {
       write_variable_length_string_data(data,mem_type,mem_space,file_type_,file_space,dtpl);
     }
@@ -891,42 +1210,15 @@ void Dataset::write_chunk(const T &data,
                           std::uint32_t filter_mask,
                           const property::DatasetTransferList &dtpl) const
 {
-  size_t databytesize = signed2unsigned<hsize_t>(mem_space.size()) * mem_type.size();
-
-  if(mem_type.get_class() == datatype::Class::Integer)
-    {
-#if H5_VERSION_GE(1,10,3)
-      if(H5Dwrite_chunk(static_cast<hid_t>(*this),
-                         static_cast<hid_t>(dtpl),
-                         filter_mask,
-                         offset.data(),
-                         databytesize,
-                         dataspace::cptr(data))<0)
-	{
-	  std::stringstream ss;
-	  ss<<"Failure to write chunk data to dataset ["<<link().path()<<"]!";
-	  error::Singleton::instance().throw_with_stack(ss.str());
-	}
-#else
-      if(H5DOwrite_chunk(static_cast<hid_t>(*this),
-                         static_cast<hid_t>(dtpl),
-                         filter_mask,
-                         offset.data(),
-                         databytesize,
-                         dataspace::cptr(data))<0)
-	{
-	  std::stringstream ss;
-	  ss<<"Failure to write chunk data to dataset ["<<link().path()<<"]!";
-	  error::Singleton::instance().throw_with_stack(ss.str());
-	}
-#endif
-    }
-  else
+  if(!datatype::is_fixed_size(mem_type))
     {
       std::stringstream ss;
-      ss<<"Failure to write non-integer chunk data to dataset ["<<link().path()<<"]!";
-      error::Singleton::instance().throw_with_stack(ss.str());
+      ss<<"Failure to write variable length chunk data to dataset ["<<link().path()<<"]!";
+      throw std::runtime_error(ss.str());
     }
+
+  size_t databytesize = signed2unsigned<hsize_t>(mem_space.size()) * mem_type.size();
+  write_chunk(dataspace::cptr(data), databytesize, offset, filter_mask, dtpl);
 }
 
 #if H5_VERSION_GE(1,10,2)
@@ -946,40 +1238,16 @@ std::uint32_t Dataset::read_chunk(T &data,
 				  std::vector<hsize_t> & offset,
 				  const property::DatasetTransferList &dtpl) const
 {
-  std::uint32_t filter_mask;
-  if(mem_type.get_class() == datatype::Class::Integer)
-    {
-#if H5_VERSION_GE(1,10,3)
-      if(H5Dread_chunk(static_cast<hid_t>(*this),
-		       static_cast<hid_t>(dtpl),
-		       offset.data(),
-		       &filter_mask,
-		       dataspace::ptr(data))<0)
-	{
-	  std::stringstream ss;
-	  ss<<"Failure to read chunk data from dataset ["<<link().path()<<"]!";
-	  error::Singleton::instance().throw_with_stack(ss.str());
-	}
-#else
-      if(H5DOread_chunk(static_cast<hid_t>(*this),
-		       static_cast<hid_t>(dtpl),
-		       offset.data(),
-		       &filter_mask,
-		       dataspace::ptr(data))<0)
-	{
-	  std::stringstream ss;
-	  ss<<"Failure to read chunk data from dataset ["<<link().path()<<"]!";
-	  error::Singleton::instance().throw_with_stack(ss.str());
-	}
-#endif
-    }
-  else
+  if(!datatype::is_fixed_size(mem_type))
     {
       std::stringstream ss;
-      ss<<"Failure to read non-integer chunk data from dataset ["<<link().path()<<"]!";
-      error::Singleton::instance().throw_with_stack(ss.str());
+      ss<<"Failure to read variable length chunk data from dataset ["<<link().path()<<"]!";
+      throw std::runtime_error(ss.str());
     }
-  return filter_mask;
+
+  hdf5::dataspace::DataspaceHolder mem_space_holder;
+  size_t databytesize = signed2unsigned<hsize_t>(mem_space_holder.get(data).size()) * mem_type.size();
+  return read_chunk(dataspace::ptr(data), databytesize, offset, dtpl);
 }
 
 #endif
@@ -1034,8 +1302,7 @@ void Dataset::read(T &data,const datatype::Datatype &mem_type,
   }
   else if(file_type_class == datatype::Class::String)
   {
-    datatype::String string_type(file_type_);
-    if(string_type.is_variable_length())
+    if(file_type_variable_string)
     {
       read_variable_length_string_data(data,mem_type,mem_space,file_type_,file_space,dtpl);
     }
@@ -1207,6 +1474,128 @@ void Dataset::read_reshape(T &data,
 }
 
 
+template<typename ...Ts>
+datatype::Compound Dataset::fields_type(const std::vector<std::string> &names)
+{
+  static_assert(sizeof...(Ts) > 0,"at least one field is required");
+  static_assert((std::is_trivially_copyable<Ts>::value && ...),
+                "field types must be trivially copyable");
+
+  if(names.size() != sizeof...(Ts))
+  {
+    std::stringstream ss;
+    ss<<"Got "<<names.size()<<" field names for "<<sizeof...(Ts)<<" fields!";
+    throw std::runtime_error(ss.str());
+  }
+
+  std::string variant;
+  for(const auto &name: names)
+    variant += name + '\n';
+
+  return datatype::Compound(datatype::TypeCache::instance().get(
+      std::type_index(typeid(std::tuple<Ts...>)),variant,
+      [&names]()
+      {
+        auto type = datatype::Compound::create((sizeof(Ts) + ...));
+        size_t index = 0;
+        size_t offset = 0;
+        ((type.insert(names[index++],offset,datatype::TypeTrait<Ts>::get()),
+          offset += sizeof(Ts)), ...);
+        return datatype::Datatype(type);
+      }));
+}
+
+template<typename ...Ts>
+void Dataset::read_fields(const std::vector<std::string> &names,
+                          std::vector<Ts> &...data) const
+{
+  read_fields(names,dataspace(),data...);
+}
+
+template<typename ...Ts>
+void Dataset::read_fields(const std::vector<std::string> &names,
+                          const dataspace::Selection &selection,
+                          std::vector<Ts> &...data) const
+{
+  dataspace::Dataspace file_space = dataspace();
+  file_space.selection(dataspace::SelectionOperation::Set,selection);
+  read_fields(names,file_space,data...);
+}
+
+template<typename ...Ts>
+void Dataset::read_fields(const std::vector<std::string> &names,
+                          const dataspace::Dataspace &file_space,
+                          std::vector<Ts> &...data) const
+{
+  auto mem_type = fields_type<Ts...>(names);
+  size_t size = file_space.selection.size();
+  (data.resize(size), ...);
+
+  if constexpr (sizeof...(Ts) == 1)
+  {
+    (read_fields_data(data.data(),mem_type,file_space), ...);
+  }
+  else
+  {
+    std::vector<unsigned char> buffer(size*mem_type.size());
+    read_fields_data(buffer.data(),mem_type,file_space);
+
+    const unsigned char *record = buffer.data();
+    for(size_t index = 0; index < size; ++index)
+    {
+      ((std::memcpy(&data[index],record,sizeof(Ts)), record += sizeof(Ts)), ...);
+    }
+  }
+}
+
+template<typename ...Ts>
+void Dataset::write_fields(const std::vector<std::string> &names,
+                           const std::vector<Ts> &...data) const
+{
+  write_fields(names,dataspace(),data...);
+}
+
+template<typename ...Ts>
+void Dataset::write_fields(const std::vector<std::string> &names,
+                           const dataspace::Selection &selection,
+                           const std::vector<Ts> &...data) const
+{
+  dataspace::Dataspace file_space = dataspace();
+  file_space.selection(dataspace::SelectionOperation::Set,selection);
+  write_fields(names,file_space,data...);
+}
+
+template<typename ...Ts>
+void Dataset::write_fields(const std::vector<std::string> &names,
+                           const dataspace::Dataspace &file_space,
+                           const std::vector<Ts> &...data) const
+{
+  auto mem_type = fields_type<Ts...>(names);
+  size_t size = file_space.selection.size();
+  if(((data.size() != size) || ...))
+  {
+    std::stringstream ss;
+    ss<<"Field vectors must have "<<size<<" elements for dataset ["
+      <<link().path()<<"]!";
+    throw std::runtime_error(ss.str());
+  }
+
+  if constexpr (sizeof...(Ts) == 1)
+  {
+    (write_fields_data(data.data(),mem_type,file_space), ...);
+  }
+  else
+  {
+    std::vector<unsigned char> buffer(size*mem_type.size());
+    unsigned char *record = buffer.data();
+    for(size_t index = 0; index < size; ++index)
+    {
+      ((std::memcpy(record,&data[index],sizeof(Ts)), record += sizeof(Ts)), ...);
+    }
+    write_fields_data(buffer.data(),mem_type,file_space);
+  }
+}
+
 //!
 //! \brief resize a dataset by a particular offset
 //!
@@ -1225,3 +1614,5 @@ DLL_EXPORT void resize_by(const Dataset &dataset,size_t dimension_index,ssize_t
 
 } // namespace node
 } // namespace hdf5
+
+#include <h5cpp/node/prepared_io.hpp>
@@ -0,0 +1,177 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <h5cpp/node/dataset_mapping.hpp>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace hdf5 {
+namespace node {
+
+DatasetMapping::DatasetMapping() noexcept:
+    mapping_(nullptr),
+    mapping_size_(0),
+    data_(nullptr),
+    size_(0),
+    shape_(),
+    strides_(),
+    type_()
+{}
+
+DatasetMapping::DatasetMapping(const fs::path &file,hsize_t offset,size_t size,
+                               const Dimensions &shape,
+                               const datatype::Datatype &type):
+    mapping_(nullptr),
+    mapping_size_(0),
+    data_(nullptr),
+    size_(size),
+    shape_(shape),
+    strides_(shape.size()),
+    type_(type)
+{
+  hsize_t stride = type.size();
+  for(size_t d = shape.size(); d-- > 0;)
+  {
+    strides_[d] = stride;
+    stride *= shape[d];
+  }
+
+#ifdef _WIN32
+  (void)file;
+  (void)offset;
+  throw std::runtime_error("Memory mapping of datasets is not supported on this platform!");
+#else
+  int fd = ::open(file.string().c_str(),O_RDONLY);
+  if(fd < 0)
+  {
+    std::stringstream ss;
+    ss<<"Failure to open file ["<<file.string()<<"] for mapping: "
+      <<std::strerror(errno);
+    throw std::runtime_error(ss.str());
+  }
+
+  // the offset of a mapping must be a multiple of the page size
+  hsize_t page_size = static_cast<hsize_t>(::sysconf(_SC_PAGESIZE));
+  hsize_t page_offset = offset - offset % page_size;
+  mapping_size_ = size + static_cast<size_t>(offset - page_offset);
+  void *mapping = ::mmap(nullptr,mapping_size_,PROT_READ,MAP_SHARED,fd,
+                         static_cast<off_t>(page_offset));
+  int error_code = errno;
+  ::close(fd);
+  if(mapping == MAP_FAILED)
+  {
+    std::stringstream ss;
+    ss<<"Failure to map "<<size<<" bytes at offset "<<offset<<" of file ["
+      <<file.string()<<"]: "<<std::strerror(error_code);
+    throw std::runtime_error(ss.str());
+  }
+  mapping_ = mapping;
+  data_ = static_cast<const unsigned char*>(mapping_) + (offset - page_offset);
+#endif
+}
+
+DatasetMapping::DatasetMapping(DatasetMapping &&mapping) noexcept:
+    mapping_(mapping.mapping_),
+    mapping_size_(mapping.mapping_size_),
+    data_(mapping.data_),
+    size_(mapping.size_),
+    shape_(std::move(mapping.shape_)),
+    strides_(std::move(mapping.strides_)),
+    type_(std::move(mapping.type_))
+{
+  mapping.mapping_ = nullptr;
+  mapping.mapping_size_ = 0;
+  mapping.data_ = nullptr;
+  mapping.size_ = 0;
+}
+
+DatasetMapping &DatasetMapping::operator=(DatasetMapping &&mapping) noexcept
+{
+  if(this != &mapping)
+  {
+    unmap();
+    mapping_ = mapping.mapping_;
+    mapping_size_ = mapping.mapping_size_;
+    data_ = mapping.data_;
+    size_ = mapping.size_;
+    shape_ = std::move(mapping.shape_);
+    strides_ = std::move(mapping.strides_);
+    type_ = std::move(mapping.type_);
+    mapping.mapping_ = nullptr;
+    mapping.mapping_size_ = 0;
+    mapping.data_ = nullptr;
+    mapping.size_ = 0;
+  }
+  return *this;
+}
+
+DatasetMapping::~DatasetMapping()
+{
+  unmap();
+}
+
+void DatasetMapping::unmap() noexcept
+{
+#ifndef _WIN32
+  if(mapping_)
+    ::munmap(mapping_,mapping_size_);
+#endif
+  mapping_ = nullptr;
+}
+
+const void *DatasetMapping::data() const noexcept
+{
+  return data_;
+}
+
+size_t DatasetMapping::size() const noexcept
+{
+  return size_;
+}
+
+const Dimensions &DatasetMapping::shape() const noexcept
+{
+  return shape_;
+}
+
+const Dimensions &DatasetMapping::strides() const noexcept
+{
+  return strides_;
+}
+
+const datatype::Datatype &DatasetMapping::type() const noexcept
+{
+  return type_;
+}
+
+} // namespace node
+} // namespace hdf5
@@ -0,0 +1,173 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <h5cpp/core/filesystem.hpp>
+#include <h5cpp/core/types.hpp>
+#include <h5cpp/core/windows.hpp>
+#include <h5cpp/datatype/datatype.hpp>
+#include <h5cpp/datatype/type_cache.hpp>
+
+namespace hdf5 {
+namespace node {
+
+//!
+//! \brief read-only memory mapping of a dataset
+//!
+//! A DatasetMapping provides direct access to the elements of a dataset by
+//! mapping the region of the file holding them into memory. No data is
+//! copied - pages are loaded on demand and shared via the page cache of the
+//! operating system with all other processes mapping the same file.
+//!
+//! The elements are laid out in row-major order as stored in the file,
+//! thus they are represented by the file type of the dataset. The mapping
+//! remains valid after the dataset and the file have been closed. Writing
+//! to the dataset while it is mapped leads to undefined results.
+//!
+//! Mappings are created by Dataset::map(). Currently only POSIX systems are
+//! supported.
+//!
+//! \code
+//! auto mapping = dataset.map();
+//! const float *data = mapping.data<float>();
+//! \endcode
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+class DLL_EXPORT DatasetMapping
+{
+  public:
+    //!
+    //! \brief default constructor
+    //!
+    //! Creates an empty mapping.
+    //!
+    DatasetMapping() noexcept;
+
+    //!
+    //! \brief constructor
+    //!
+    //! \throws std::runtime_error if the file cannot be mapped
+    //! \param file path to the file holding the data
+    //! \param offset offset of the data in the file in bytes
+    //! \param size number of bytes to map
+    //! \param shape number of elements along each dimension
+    //! \param type datatype of the elements in the file
+    //!
+    DatasetMapping(const fs::path &file,hsize_t offset,size_t size,
+                   const Dimensions &shape,const datatype::Datatype &type);
+
+    DatasetMapping(const DatasetMapping &) = delete;
+    DatasetMapping &operator=(const DatasetMapping &) = delete;
+
+    //!
+    //! \brief move constructor
+    //!
+    DatasetMapping(DatasetMapping &&mapping) noexcept;
+
+    //!
+    //! \brief move assignment
+    //!
+    DatasetMapping &operator=(DatasetMapping &&mapping) noexcept;
+
+    //!
+    //! \brief destructor
+    //!
+    //! Unmaps the data.
+    //!
+    ~DatasetMapping();
+
+    //!
+    //! \brief pointer to the first element
+    //!
+    const void *data() const noexcept;
+
+    //!
+    //! \brief pointer to the first element
+    //!
+    //! \throws std::runtime_error if the file type does not match T
+    //! \tparam T element type
+    //!
+    template<typename T>
+    const T *data() const;
+
+    //!
+    //! \brief number of mapped bytes
+    //!
+    size_t size() const noexcept;
+
+    //!
+    //! \brief number of elements along each dimension
+    //!
+    const Dimensions &shape() const noexcept;
+
+    //!
+    //! \brief distance between two elements along each dimension in bytes
+    //!
+    const Dimensions &strides() const noexcept;
+
+    //!
+    //! \brief the datatype of the elements
+    //!
+    const datatype::Datatype &type() const noexcept;
+
+  private:
+    void *mapping_;
+    size_t mapping_size_;
+    const unsigned char *data_;
+    size_t size_;
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+    Dimensions shape_;
+    Dimensions strides_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+    datatype::Datatype type_;
+
+    void unmap() noexcept;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+template<typename T>
+const T *DatasetMapping::data() const
+{
+  if(datatype::TypeCache::instance().get<T>() != type_)
+  {
+    throw std::runtime_error("Requested element type does not match the file type of the mapped dataset!");
+  }
+  return reinterpret_cast<const T*>(data_);
+}
+
+} // namespace node
+} // namespace hdf5
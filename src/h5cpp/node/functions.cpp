@@ -24,10 +24,21 @@
 //
 #include <sstream>
 #include <h5cpp/node/functions.hpp>
+#include <h5cpp/node/path_cache.hpp>
+#include <h5cpp/core/executor.hpp>
 
 namespace hdf5 {
 namespace node {
 
+namespace {
+
+Path absolute_path(const Group &base,const Path &path)
+{
+  return path.absolute() ? path : base.link().path() + path;
+}
+
+} // anonymous namespace
+
 void copy(const Node &source, const Group& base, const Path &relative_path,
           const property::ObjectCopyList &ocpl,
           const property::LinkCreationList &lcpl)
@@ -47,6 +58,8 @@ void copy(const Node &source, const Group& base, const Path &relative_path,
        << base.link() << " / " << relative_path;
     error::Singleton::instance().throw_with_stack(ss.str());
   }
+  PathCache::instance().invalidate(base.link().file(),
+                                   absolute_path(base, relative_path));
 }
 
 void copy(const Node &source, const Group& destination,
@@ -68,6 +81,8 @@ void remove(const Group &base, const Path &object_path,
        << base.link() << " / " << object_path;
     error::Singleton::instance().throw_with_stack(ss.str());
   }
+  // soft links may refer to the removed object under other paths
+  PathCache::instance().invalidate(base.link().file());
 }
 
 void remove(const Node &object,
@@ -97,6 +112,9 @@ void move(const Node &source,
        << base.link() << " / " << relative_path;
     error::Singleton::instance().throw_with_stack(ss.str());
   }
+  // soft links may refer to the moved object under other paths
+  PathCache::instance().invalidate(source.link().file());
+  PathCache::instance().invalidate(base.link().file());
 }
 
 void move(const Node &source,
@@ -128,6 +146,8 @@ void link(const fs::path &target_file,
        << target_file << " / " << target_path;
     error::Singleton::instance().throw_with_stack(ss.str());
   }
+  PathCache::instance().invalidate(link_base.link().file(),
+                                   absolute_path(link_base, link_path));
 }
 
 void link(const Path &target_path,
@@ -150,6 +170,8 @@ void link(const Path &target_path,
        << target_path;
     error::Singleton::instance().throw_with_stack(ss.str());
   }
+  PathCache::instance().invalidate(link_base.link().file(),
+                                   absolute_path(link_base, link_path));
 }
 
 void link(const Node &target,
@@ -188,7 +210,10 @@ Group get_real_base(const Group &base, const Path &path,
   return Group(real_base_node);
 }
 
-Node get_node(const Group &base,const Path &node_path,const property::LinkAccessList &lapl)
+namespace {
+
+Node resolve_node(const Group &base,const Path &node_path,
+                  const property::LinkAccessList &lapl)
 {
 
   Group search_base(base);
@@ -211,7 +236,7 @@ Node get_node(const Group &base,const Path &node_path,const property::LinkAccess
     search_path.absolute(false); //make search path relative to root group
 
     //and start it all over again
-    return get_node(search_base,search_path,lapl);
+    return resolve_node(search_base,search_path,lapl);
   }
   else
   {
@@ -228,7 +253,8 @@ Node get_node(const Group &base,const Path &node_path,const property::LinkAccess
       }
       else
       {
-        return get_node(Group(result),search_path);
+        return resolve_node(Group(result),search_path,
+                            property::LinkAccessList());
       }
     }
     else
@@ -242,6 +268,92 @@ Node get_node(const Group &base,const Path &node_path,const property::LinkAccess
 
 }
 
+} // anonymous namespace
+
+Node get_node(const Group &base,const Path &node_path,const property::LinkAccessList &lapl)
+{
+  PathCache &cache = PathCache::instance();
+  if(!cache.is_active() || node_path.is_root() || node_path.size()==0)
+    return resolve_node(base,node_path,lapl);
+
+  const file::File &file = base.link().file();
+  Path path = absolute_path(base,node_path);
+  Node node;
+  if(cache.lookup(file,path,node))
+    return node;
+
+  node = resolve_node(base,node_path,lapl);
+  cache.insert(file,path,node);
+  return node;
+}
+
+namespace {
+
+std::optional<Type> probe_type(hid_t base,const Path &node_path,hid_t lapl)
+{
+  std::string name = node_path.absolute() ? "/" : "";
+  size_t remaining = node_path.size();
+  for(const auto &link_name: node_path)
+  {
+    name += link_name;
+    //
+    // H5Lexists only reports a missing link without an error if all
+    // preceding links exist
+    //
+    if(H5Lexists(base,name.c_str(),lapl)<=0)
+      return std::nullopt;
+    if(--remaining)
+      name += "/";
+  }
+
+  H5O_info_t_ info;
+#if H5_VERSION_GE(1,10,3)
+  if(H5Oget_info_by_name2(base,name.c_str(),&info,H5O_INFO_BASIC,lapl)<0)
+#else
+  if(H5Oget_info_by_name(base,name.c_str(),&info,lapl)<0)
+#endif
+    return std::nullopt;
+
+  return static_cast<Type>(info.type);
+}
+
+} // anonymous namespace
+
+std::optional<Type> find_type(const Group &base,const Path &node_path,
+                              const property::LinkAccessList &lapl) noexcept
+{
+  if(node_path.is_root() || node_path.size()==0)
+    return Type::Group;
+
+  try
+  {
+    return concurrency::Executor::instance().run([&]()
+    {
+      std::optional<Type> type;
+      H5E_BEGIN_TRY
+      {
+        type = probe_type(static_cast<hid_t>(base),node_path,
+                          static_cast<hid_t>(lapl));
+      }
+      H5E_END_TRY;
+      return type;
+    });
+  }
+  catch(...)
+  {
+    return std::nullopt;
+  }
+}
+
+std::optional<Node> find_node(const Group &base,const Path &node_path,
+                              const property::LinkAccessList &lapl)
+{
+  if(!find_type(base,node_path,lapl))
+    return std::nullopt;
+
+  return get_node(base,node_path,lapl);
+}
+
 bool is_group(const Node &node)
 {
   return node.type() == Type::Group;
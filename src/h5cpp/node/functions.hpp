@@ -25,6 +25,7 @@
 //
 #pragma once
 
+#include <optional>
 #include <h5cpp/node/node.hpp>
 #include <h5cpp/node/group.hpp>
 #include <h5cpp/node/dataset.hpp>
@@ -259,6 +260,49 @@ DLL_EXPORT Node get_node(const Group &base,
                          const Path &node_path,
                          const property::LinkAccessList &lapl = property::LinkAccessList());
 
+//!
+//! \brief get the type of a node without throwing
+//!
+//! Probes every link along the path with H5Lexists and the final object
+//! with H5Oget_info_by_name. No object is opened and automatic error
+//! printing is suppressed during the lookup, which makes this function
+//! considerably cheaper than catching the exception thrown by get_node()
+//! for a missing node. Unlike get_node() the path cache is not used.
+//!
+//! \code
+//! if(node::find_type(root,"/entry/sample/temperature")==node::Type::Dataset)
+//! {
+//!   ...
+//! }
+//! \endcode
+//!
+//! \param base reference to the base group
+//! \param node_path path to the node
+//! \param lapl optional link access property list
+//! \return the type of the node or an empty value if no object can be
+//!         reached via the path
+//!
+DLL_EXPORT std::optional<Type> find_type(const Group &base,
+                                         const Path &node_path,
+                                         const property::LinkAccessList &lapl = property::LinkAccessList()) noexcept;
+
+//!
+//! \brief get node if it exists
+//!
+//! Like get_node() but returns an empty value instead of throwing if no
+//! object can be reached via the path. Only existing nodes are opened.
+//!
+//! \throws std::runtime_error if an existing node cannot be opened
+//! \param base reference to the base group
+//! \param node_path path to the node
+//! \param lapl optional link access property list
+//! \return the node or an empty value
+//! \sa find_type
+//!
+DLL_EXPORT std::optional<Node> find_node(const Group &base,
+                                         const Path &node_path,
+                                         const property::LinkAccessList &lapl = property::LinkAccessList());
+
 
 //!
 //! \brief get real base of path
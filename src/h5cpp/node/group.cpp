@@ -206,30 +206,12 @@ void Group::remove(const Path &path,
 
 bool Group::has_group(const Path &path, const property::LinkAccessList &lapl) const noexcept
 {
-  bool ret = false;
-  try
-  {
-    ret = hdf5::node::is_group(hdf5::node::get_node(*this, path, lapl));
-  }
-  catch (...)
-  {
-    return false;
-  }
-  return ret;
+  return hdf5::node::find_type(*this, path, lapl) == Type::Group;
 }
 
 bool Group::has_dataset(const Path &path, const property::LinkAccessList &lapl) const noexcept
 {
-  bool ret = false;
-  try
-  {
-    ret = hdf5::node::is_dataset(hdf5::node::get_node(*this, path, lapl));
-  }
-  catch (...)
-  {
-    return false;
-  }
-  return ret;
+  return hdf5::node::find_type(*this, path, lapl) == Type::Dataset;
 }
 
 Group Group::get_group(const Path &path, const property::LinkAccessList &lapl) const
@@ -33,7 +33,10 @@ namespace node {
 LinkIterator::LinkIterator(const Group &group,ssize_t index):
     Iterator(index),
     group_(group),
-    current_link_()
+    current_link_(),
+    listing_(),
+    listing_index_(group.iterator_config().index()),
+    listing_order_(group.iterator_config().order())
 {
 }
 
@@ -47,15 +50,33 @@ LinkIterator LinkIterator::end(const Group &group)
   return LinkIterator(group,unsigned2signed<ssize_t>(group.links.size()));
 }
 
+Link LinkIterator::current() const
+{
+  const IteratorConfig &config = group_.iterator_config();
+  if(!listing_ ||
+     listing_index_!=config.index() || listing_order_!=config.order())
+  {
+    listing_ = std::make_shared<const LinkListing>(group_.links.list());
+    listing_index_ = config.index();
+    listing_order_ = config.order();
+  }
+
+  size_t i = signed2unsigned<size_t>(index());
+  if(i<listing_->size())
+    return Link(group_.link().file(),group_.link().path(),(*listing_)[i].name);
+
+  return group_.links[i];
+}
+
 Link LinkIterator::operator*() const
 {
-  current_link_ = group_.links[signed2unsigned<size_t>(index())];
+  current_link_ = current();
   return current_link_;
 }
 
 Link *LinkIterator::operator->()
 {
-  current_link_ = group_.links[signed2unsigned<size_t>(index())];
+  current_link_ = current();
   return &current_link_;
 }
 
@@ -88,11 +109,12 @@ LinkIterator LinkIterator::operator--(int)
 
 bool LinkIterator::operator==(const LinkIterator &a) const
 {
-  //check first if we iterate over the same group
-  if(group_.id()!=a.group_.id())
+  //the index is cheap to compare - the group id requires a query to the
+  //library and is thus only checked for iterators at the same position
+  if(index()!=a.index())
     return false;
 
-  if(index()!=a.index())
+  if(group_.id()!=a.group_.id())
     return false;
 
   return true;
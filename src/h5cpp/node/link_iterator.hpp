@@ -25,9 +25,11 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <h5cpp/core/iterator.hpp>
 #include <h5cpp/node/link_view.hpp>
 #include <h5cpp/node/link.hpp>
+#include <h5cpp/node/link_listing.hpp>
 #include <h5cpp/core/windows.hpp>
 #include <h5cpp/node/group.hpp>
 
@@ -74,6 +76,29 @@ class DLL_EXPORT LinkIterator : public Iterator
 #endif
     mutable Link current_link_;
 
+    //!
+    //! \brief listing of the links of the group
+    //!
+    //! The listing is created on first access and shared with copies
+    //! of the iterator made afterwards. It is recreated if the index or order of the
+    //! iterator configuration of the group changes.
+    //!
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+    mutable std::shared_ptr<const LinkListing> listing_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+    mutable IterationIndex listing_index_ {IterationIndex::Name};
+    mutable IterationOrder listing_order_ {IterationOrder::Native};
+
+    //!
+    //! \brief get the link at the current position
+    //!
+    Link current() const;
+
 };
 #ifdef __clang__
 #pragma clang diagnostic pop
@@ -0,0 +1,70 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <string>
+#include <vector>
+#include <h5cpp/core/hdf5_capi.hpp>
+#include <h5cpp/node/types.hpp>
+
+namespace hdf5 {
+namespace node {
+
+//!
+//! \brief a single entry of a link listing
+//!
+//! Describes one link of a group as reported by a single pass of
+//! H5Literate. Only hard links carry an object address, for soft and
+//! external links the address is HADDR_UNDEF.
+//!
+//! \sa LinkView::list
+//!
+struct LinkEntry
+{
+  //!
+  //! \brief name of the link
+  //!
+  std::string name;
+
+  //!
+  //! \brief type of the link
+  //!
+  LinkType type;
+
+  //!
+  //! \brief address of the object referenced by a hard link
+  //!
+  haddr_t address;
+};
+
+//!
+//! \brief snapshot of all links of a group
+//!
+//! The entries are stored in the order given by the iterator configuration
+//! of the group at the time the listing was created.
+//!
+using LinkListing = std::vector<LinkEntry>;
+
+} // namespace node
+} // namespace hdf5
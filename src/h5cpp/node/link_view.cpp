@@ -42,45 +42,35 @@ Link LinkView::operator[](size_t index) const
 
 
   //------------------------------------------------------------------------
-  // determine the size of the link name
+  // try to load the name with a buffer which fits most link names - only
+  // if the name is longer a second call with the exact size is required
   //------------------------------------------------------------------------
-  ssize_t size = H5Lget_name_by_idx(static_cast<hid_t>(group()),
-                                    ".",
-                                    static_cast<H5_index_t>(config.index()),
-                                    static_cast<H5_iter_order_t>(config.order()),
-                                    index,
-                                    nullptr,
-                                    0,
-                                    static_cast<hid_t>(config.link_access_list()));
-  if(size<0)
+  std::string name(64,'\0');
+  ssize_t size = 0;
+  while(true)
   {
-    std::stringstream ss;
-    ss<<"Could not determine the size of link "<<index<<" on group ["
-      <<group().link().path()<<"]!";
-    error::Singleton::instance().throw_with_stack(ss.str());
-  }
-
-  //setting up the string where to store the name
-  std::string name(signed2unsigned<size_t>(size),' ');
-
-  //------------------------------------------------------------------------
-  // load the link name
-  //------------------------------------------------------------------------
-  size = H5Lget_name_by_idx(static_cast<hid_t>(group()),
-                            ".",
-                            static_cast<H5_index_t>(config.index()),
-                            static_cast<H5_iter_order_t>(config.order()),
-                            index,
-                            const_cast<char*>(name.data()),
-                            signed2unsigned<size_t>(size+1),
-                            static_cast<hid_t>(config.link_access_list()));
-  if(size<0)
-  {
-    std::stringstream ss;
-    ss<<"Could not load name for link "<<index<<" on group ["
-        <<group().link().path()<<"]!";
-    error::Singleton::instance().throw_with_stack(ss.str());
+    size = H5Lget_name_by_idx(static_cast<hid_t>(group()),
+                              ".",
+                              static_cast<H5_index_t>(config.index()),
+                              static_cast<H5_iter_order_t>(config.order()),
+                              index,
+                              const_cast<char*>(name.data()),
+                              name.size(),
+                              static_cast<hid_t>(config.link_access_list()));
+    if(size<0)
+    {
+      std::stringstream ss;
+      ss<<"Could not load name for link "<<index<<" on group ["
+          <<group().link().path()<<"]!";
+      error::Singleton::instance().throw_with_stack(ss.str());
+    }
+
+    if(signed2unsigned<size_t>(size)<name.size())
+      break;
+
+    name.resize(signed2unsigned<size_t>(size+1));
   }
+  name.resize(signed2unsigned<size_t>(size));
 
   return Link(group().link().file(),group().link().path(),name);
 
@@ -130,6 +120,48 @@ bool LinkView::exists(const std::string &name, const property::LinkAccessList &l
 #endif
 }
 
+namespace {
+
+#if H5_VERSION_GE(1,11,0)
+#define H5L_info_t_ H5L_info1_t
+#define H5Literate_ H5Literate1
+#else
+#define H5L_info_t_ H5L_info_t
+#define H5Literate_ H5Literate
+#endif
+
+herr_t append_link_entry(hid_t,const char *name,const H5L_info_t_ *info,
+                         void *op_data)
+{
+  auto listing = static_cast<LinkListing*>(op_data);
+  haddr_t address = info->type==H5L_TYPE_HARD ? info->u.address : HADDR_UNDEF;
+  listing->push_back(LinkEntry{name,static_cast<LinkType>(info->type),address});
+  return 0;
+}
+
+} // anonymous namespace
+
+LinkListing LinkView::list() const
+{
+  const IteratorConfig &config = group().iterator_config();
+
+  LinkListing listing;
+  listing.reserve(size());
+
+  hsize_t index = 0;
+  if(H5Literate_(static_cast<hid_t>(group()),
+                 static_cast<H5_index_t>(config.index()),
+                 static_cast<H5_iter_order_t>(config.order()),
+                 &index,append_link_entry,&listing)<0)
+  {
+    std::stringstream ss;
+    ss<<"Failure listing the links of group ["<<group().link().path()<<"]!";
+    error::Singleton::instance().throw_with_stack(ss.str());
+  }
+
+  return listing;
+}
+
 LinkView::const_iterator LinkView::begin() const
 {
   return LinkIterator::begin(group());
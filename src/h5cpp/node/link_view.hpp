@@ -25,6 +25,7 @@
 #pragma once
 
 #include <h5cpp/node/group_view.hpp>
+#include <h5cpp/node/link_listing.hpp>
 #include <h5cpp/core/windows.hpp>
 
 namespace hdf5 {
@@ -60,6 +61,22 @@ class DLL_EXPORT LinkView : public GroupView
     Link operator[](size_t index) const;
     Link operator[](const std::string &name) const;
 
+    //!
+    //! \brief list all links of the group
+    //!
+    //! Collects name, type and object address of every link in a single
+    //! pass over the group using the index and order of the groups
+    //! iterator configuration. This is O(n) in the number of links while
+    //! accessing each link by index costs a separate lookup per link.
+    //!
+    //! The returned listing is a snapshot. Links created or removed after
+    //! the call are not reflected.
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \return vector with one entry per link
+    //!
+    LinkListing list() const;
+
     const_iterator begin() const;
     const_iterator end() const;
 };
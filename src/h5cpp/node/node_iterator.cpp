@@ -26,6 +26,8 @@
 #include <h5cpp/node/node_iterator.hpp>
 #include <h5cpp/node/group.hpp>
 #include <h5cpp/core/utilities.hpp>
+#include <h5cpp/error/error.hpp>
+#include <sstream>
 
 namespace hdf5 {
 namespace node {
@@ -33,7 +35,10 @@ namespace node {
 NodeIterator::NodeIterator(const Group &group,ssize_t index):
     Iterator(index),
     group_(group),
-    current_node_()
+    current_node_(),
+    listing_(),
+    listing_index_(group.iterator_config().index()),
+    listing_order_(group.iterator_config().order())
 {}
 
 
@@ -47,15 +52,50 @@ NodeIterator NodeIterator::end(const Group &group)
   return NodeIterator(group,unsigned2signed<ssize_t>(group.nodes.size()));
 }
 
+Node NodeIterator::current() const
+{
+  const IteratorConfig &config = group_.iterator_config();
+  if(!listing_ ||
+     listing_index_!=config.index() || listing_order_!=config.order())
+  {
+    listing_ = std::make_shared<const LinkListing>(group_.links.list());
+    listing_index_ = config.index();
+    listing_order_ = config.order();
+  }
+
+  size_t i = signed2unsigned<size_t>(index());
+  if(i<listing_->size())
+  {
+    const LinkEntry &entry = (*listing_)[i];
+    if(entry.type!=LinkType::Hard)
+      return group_.nodes[entry.name];
+
+    // hard links can be opened directly by address without resolving
+    // the name again
+    hid_t id = H5Oopen_by_addr(static_cast<hid_t>(group_),entry.address);
+    if(id<0)
+    {
+      std::stringstream ss;
+      ss<<"Failure opening child ["<<entry.name<<"] from group "
+        <<group_.link().path();
+      error::Singleton::instance().throw_with_stack(ss.str());
+    }
+    return Node(ObjectHandle(id),
+                Link(group_.link().file(),group_.link().path(),entry.name));
+  }
+
+  return group_.nodes[i];
+}
+
 Node NodeIterator::operator*() const
 {
-  current_node_ = group_.nodes[signed2unsigned<size_t>(index())];
+  current_node_ = current();
   return current_node_;
 }
 
 Node *NodeIterator::operator->()
 {
-  current_node_ = group_.nodes[signed2unsigned<size_t>(index())];
+  current_node_ = current();
   return &current_node_;
 }
 
@@ -88,11 +128,12 @@ NodeIterator NodeIterator::operator--(int)
 
 bool NodeIterator::operator==(const NodeIterator &a) const
 {
-  //check first if we iterate over the same group
-  if(group_.id()!=a.group_.id())
+  //the index is cheap to compare - the group id requires a query to the
+  //library and is thus only checked for iterators at the same position
+  if(index()!=a.index())
     return false;
 
-  if(index()!=a.index())
+  if(group_.id()!=a.group_.id())
     return false;
 
   return true;
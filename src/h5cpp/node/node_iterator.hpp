@@ -25,9 +25,11 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <h5cpp/core/iterator.hpp>
 #include <h5cpp/node/group.hpp>
 #include <h5cpp/node/node.hpp>
+#include <h5cpp/node/link_listing.hpp>
 #include <h5cpp/core/windows.hpp>
 
 namespace hdf5 {
@@ -117,6 +119,29 @@ class DLL_EXPORT NodeIterator : public Iterator
     //!
     mutable Node current_node_;
 
+    //!
+    //! \brief listing of the links of the group
+    //!
+    //! The listing is created on first access and shared with copies
+    //! of the iterator made afterwards. It is recreated if the index or order of the
+    //! iterator configuration of the group changes.
+    //!
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+    mutable std::shared_ptr<const LinkListing> listing_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+    mutable IterationIndex listing_index_ {IterationIndex::Name};
+    mutable IterationOrder listing_order_ {IterationOrder::Native};
+
+    //!
+    //! \brief get the node at the current position
+    //!
+    Node current() const;
+
 };
 #ifdef __clang__
 #pragma clang diagnostic pop
@@ -0,0 +1,201 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+
+#include <mutex>
+#include <stdexcept>
+#include <h5cpp/core/object_id.hpp>
+#include <h5cpp/error/error.hpp>
+#include <h5cpp/node/group.hpp>
+#include <h5cpp/node/path_cache.hpp>
+
+namespace hdf5 {
+namespace node {
+
+namespace {
+
+bool is_below(const std::string &path,const std::string &prefix)
+{
+  if(prefix == "/")
+    return true;
+
+  return path.compare(0,prefix.size(),prefix) == 0 &&
+         (path.size() == prefix.size() || path[prefix.size()] == '/');
+}
+
+} // anonymous namespace
+
+PathCache &PathCache::instance()
+{
+  static PathCache cache;
+  return cache;
+}
+
+PathCache::PathCache():
+    mutex_(),
+    files_(),
+    active_(false),
+    hits_(0),
+    misses_(0)
+{}
+
+void PathCache::enable(const file::File &file)
+{
+  if(!file.is_valid())
+    throw std::runtime_error("Cannot enable the path cache for an invalid file!");
+
+  hid_t id = static_cast<hid_t>(file);
+  if(is_enabled(file))
+    return;
+
+  unsigned long file_number = file.root().id().file_number();
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  files_.emplace(id,FileEntry{file,file_number,{}});
+  active_ = true;
+}
+
+void PathCache::disable(const file::File &file)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  files_.erase(static_cast<hid_t>(file));
+  active_ = !files_.empty();
+}
+
+bool PathCache::is_enabled(const file::File &file) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return files_.count(static_cast<hid_t>(file)) != 0;
+}
+
+void PathCache::invalidate(const file::File &file,const Path &path)
+{
+  if(!is_active())
+    return;
+
+  std::string prefix = static_cast<std::string>(path);
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  auto entry = files_.find(static_cast<hid_t>(file));
+  if(entry == files_.end())
+    return;
+
+  auto &addresses = entry->second.addresses;
+  for(auto iter = addresses.begin(); iter != addresses.end();)
+  {
+    if(is_below(iter->first,prefix))
+      iter = addresses.erase(iter);
+    else
+      ++iter;
+  }
+}
+
+void PathCache::invalidate(const file::File &file)
+{
+  if(!is_active())
+    return;
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  auto entry = files_.find(static_cast<hid_t>(file));
+  if(entry != files_.end())
+    entry->second.addresses.clear();
+}
+
+bool PathCache::lookup(const file::File &file,const Path &path,Node &node)
+{
+  hid_t id = static_cast<hid_t>(file);
+  std::string key = static_cast<std::string>(path);
+  haddr_t address = HADDR_UNDEF;
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto entry = files_.find(id);
+    if(entry == files_.end())
+      return false;
+
+    auto iter = entry->second.addresses.find(key);
+    if(iter == entry->second.addresses.end())
+    {
+      ++misses_;
+      return false;
+    }
+    address = iter->second;
+  }
+
+  hid_t object = H5Oopen_by_addr(id,address);
+  if(object < 0)
+  {
+    error::Singleton::instance().throw_with_stack(
+        "Failure opening cached object ["+key+"]!");
+  }
+
+  ++hits_;
+  node = Node(ObjectHandle(object),Link(file,path.parent(),path.name()));
+  return true;
+}
+
+void PathCache::insert(const file::File &file,const Path &path,
+                       const Node &node)
+{
+  ObjectId id = node.id();
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  auto entry = files_.find(static_cast<hid_t>(file));
+  if(entry == files_.end() || entry->second.file_number != id.file_number())
+    return;
+
+  entry->second.addresses[static_cast<std::string>(path)] = id.object_address();
+}
+
+bool PathCache::is_active() const noexcept
+{
+  return active_;
+}
+
+size_t PathCache::hits() const noexcept
+{
+  return hits_;
+}
+
+size_t PathCache::misses() const noexcept
+{
+  return misses_;
+}
+
+size_t PathCache::size() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  size_t size = 0;
+  for(const auto &entry: files_)
+    size += entry.second.addresses.size();
+  return size;
+}
+
+void PathCache::clear()
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  files_.clear();
+  active_ = false;
+  hits_ = 0;
+  misses_ = 0;
+}
+
+} // namespace node
+} // namespace hdf5
@@ -0,0 +1,201 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <atomic>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <h5cpp/core/hdf5_capi.hpp>
+#include <h5cpp/core/path.hpp>
+#include <h5cpp/core/windows.hpp>
+#include <h5cpp/file/file.hpp>
+#include <h5cpp/node/node.hpp>
+
+namespace hdf5 {
+namespace node {
+
+//!
+//! \brief process-wide cache for path lookups
+//!
+//! Resolving a path with get_node() opens every component of the path. For
+//! files registered with enable() the cache maps the absolute path of every
+//! object found by get_node() to its address. Repeated lookups of the same
+//! path open the object directly by address.
+//!
+//! The cache works on the file handle passed to enable(). It is shared by
+//! all copies of it, and by all nodes obtained from it. Files opened
+//! separately have their own handles and are not affected. The cache keeps
+//! the file open until disable() is called.
+//!
+//! Entries are invalidated by the functions of h5cpp which create, move or
+//! remove links. Changes to the file made by other means are not noticed.
+//! Only objects stored in the file itself are cached. Objects reached via
+//! external links are always looked up again.
+//!
+//! All member functions are thread-safe.
+//!
+//! \code
+//! auto &cache = node::PathCache::instance();
+//! cache.enable(file);
+//! auto root = file.root();
+//! for(size_t frame = 0; frame < frames; ++frame)
+//!   root.get_dataset("/entry/instrument/detector/data").read(buffer,...);
+//! std::cout<<cache.hits()<<" "<<cache.misses()<<std::endl;
+//! \endcode
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+class DLL_EXPORT PathCache
+{
+  public:
+    //!
+    //! \brief reference to the process-wide cache
+    //!
+    static PathCache &instance();
+
+    PathCache(const PathCache &) = delete;
+    PathCache &operator=(const PathCache &) = delete;
+
+    //!
+    //! \brief start caching lookups on a file
+    //!
+    //! Has no effect if caching is already enabled for the file.
+    //!
+    //! \throws std::runtime_error if the file is not valid
+    //! \param file the file
+    //!
+    void enable(const file::File &file);
+
+    //!
+    //! \brief stop caching lookups on a file
+    //!
+    //! Removes all entries of the file and releases its handle.
+    //!
+    //! \param file the file
+    //!
+    void disable(const file::File &file);
+
+    //!
+    //! \brief true if lookups on the file are cached
+    //!
+    //! \param file the file
+    //!
+    bool is_enabled(const file::File &file) const;
+
+    //!
+    //! \brief remove the entries for a path and all paths below it
+    //!
+    //! \param file the file
+    //! \param path absolute path
+    //!
+    void invalidate(const file::File &file,const Path &path);
+
+    //!
+    //! \brief remove all entries of a file
+    //!
+    //! \param file the file
+    //!
+    void invalidate(const file::File &file);
+
+    //!
+    //! \brief look up an object
+    //!
+    //! \throws std::runtime_error if the cached object cannot be opened
+    //! \param file the file
+    //! \param path absolute path of the object
+    //! \param node set to the object if it was found
+    //! \return true if the object was found
+    //!
+    bool lookup(const file::File &file,const Path &path,Node &node);
+
+    //!
+    //! \brief add an object found by a regular lookup
+    //!
+    //! Objects stored in another file than file are ignored.
+    //!
+    //! \param file the file
+    //! \param path absolute path of the object
+    //! \param node the object
+    //!
+    void insert(const file::File &file,const Path &path,const Node &node);
+
+    //!
+    //! \brief true if caching is enabled for any file
+    //!
+    //! Allows get_node() to skip the cache without taking a lock.
+    //!
+    bool is_active() const noexcept;
+
+    //!
+    //! \brief number of lookups which found an object
+    //!
+    size_t hits() const noexcept;
+
+    //!
+    //! \brief number of lookups on enabled files which found no object
+    //!
+    size_t misses() const noexcept;
+
+    //!
+    //! \brief number of cached paths over all files
+    //!
+    size_t size() const;
+
+    //!
+    //! \brief disable caching for all files and reset the counters
+    //!
+    void clear();
+
+  private:
+    PathCache();
+
+    struct FileEntry
+    {
+      file::File file;
+      unsigned long file_number;
+      std::unordered_map<std::string,haddr_t> addresses;
+    };
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<hid_t,FileEntry> files_;
+    std::atomic<bool> active_;
+    std::atomic<size_t> hits_;
+    std::atomic<size_t> misses_;
+};
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+} // namespace node
+} // namespace hdf5
@@ -0,0 +1,329 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <sstream>
+#include <stdexcept>
+#include <h5cpp/core/types.hpp>
+#include <h5cpp/dataspace/hyperslab.hpp>
+#include <h5cpp/dataspace/simple.hpp>
+#include <h5cpp/datatype/type_cache.hpp>
+#include <h5cpp/error/error.hpp>
+#include <h5cpp/node/dataset.hpp>
+#include <h5cpp/property/dataset_transfer.hpp>
+
+namespace hdf5 {
+namespace node {
+
+//!
+//! \brief common state of prepared IO operations
+//!
+//! Holds everything libhdf5 needs for a transfer - the memory type, the
+//! memory space, the file space with the selection applied and the
+//! transfer property list - so that repeated transfers of the same shape
+//! cost a single \c H5Dwrite or \c H5Dread call.
+//!
+//! The memory type is derived from T alone, thus T must be a type whose
+//! HDF5 type does not depend on the instance (this excludes fixed length
+//! strings). The memory space has the shape of the selection.
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+template<typename T>
+class PreparedTransfer
+{
+  public:
+    //!
+    //! \brief get the dataset
+    //!
+    const Dataset &dataset() const noexcept
+    {
+      return dataset_;
+    }
+
+    //!
+    //! \brief the current selection in the dataset
+    //!
+    const dataspace::Hyperslab &selection() const noexcept
+    {
+      return selection_;
+    }
+
+    //!
+    //! \brief move the selection along a dimension
+    //!
+    //! Moves the selection by its own extent along the given dimension, so
+    //! that it selects the next block of the dataset.
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param dimension index of the dimension
+    //!
+    void advance(size_t dimension = 0)
+    {
+      check_dimension(dimension);
+      selection_.offset(dimension,selection_.offset()[dimension] +
+                                  selection_.dimensions()[dimension]);
+      file_space_.selection(dataspace::SelectionOperation::Set,selection_);
+    }
+
+  protected:
+    PreparedTransfer(const Dataset &dataset,
+                     const dataspace::Hyperslab &selection,
+                     const property::DatasetTransferList &dtpl):
+        dataset_(dataset),
+        selection_(selection),
+        mem_type_(datatype::TypeCache::instance().get<T>()),
+        mem_space_(selection.dimensions()),
+        file_space_(dataset.dataspace()),
+        dtpl_(dtpl)
+    {
+      if(selection.rank() != file_space_.rank())
+      {
+        std::stringstream ss;
+        ss<<"Rank of selection does not match the rank of dataset ["
+          <<dataset.link().path()<<"]!";
+        throw std::runtime_error(ss.str());
+      }
+      file_space_.selection(dataspace::SelectionOperation::Set,selection_);
+    }
+
+    PreparedTransfer(const Dataset &dataset,
+                     const property::DatasetTransferList &dtpl):
+        PreparedTransfer(dataset,whole_dataset(dataset),dtpl)
+    {}
+
+    void check_dimension(size_t dimension) const
+    {
+      if(dimension >= selection_.rank())
+      {
+        std::stringstream ss;
+        ss<<"Dimension "<<dimension<<" exceeds the rank of dataset ["
+          <<dataset_.link().path()<<"]!";
+        throw std::runtime_error(ss.str());
+      }
+    }
+
+    Dataset dataset_;
+    dataspace::Hyperslab selection_;
+    datatype::Datatype mem_type_;
+    dataspace::Simple mem_space_;
+    dataspace::Simple file_space_;
+    property::DatasetTransferList dtpl_;
+
+  private:
+    static dataspace::Hyperslab whole_dataset(const Dataset &dataset)
+    {
+      Dimensions dims = dataspace::Simple(dataset.dataspace()).current_dimensions();
+      return dataspace::Hyperslab(Dimensions(dims.size(),0),dims);
+    }
+};
+
+//!
+//! \brief prepared write operation
+//!
+//! A PreparedWrite writes instances of T to a fixed selection of a dataset
+//! without setting up memory type, memory space and file space for every
+//! call. With advance() or append() the selection can be moved through
+//! the dataset, for instance to write one frame after the other.
+//!
+//! \code
+//! auto writer = dataset.prepare_write<std::vector<float>>(
+//!                   dataspace::Hyperslab{{0,0,0},{1,ny,nx}});
+//! for(const auto &frame: frames)
+//!   writer.append(frame);
+//! \endcode
+//!
+//! \sa Dataset::prepare_write
+//!
+template<typename T>
+class PreparedWrite : public PreparedTransfer<T>
+{
+  public:
+    //!
+    //! \brief constructor
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param dataset the dataset to write to
+    //! \param selection the part of the dataset to write
+    //! \param dtpl the dataset transfer property list
+    //!
+    PreparedWrite(const Dataset &dataset,const dataspace::Hyperslab &selection,
+                  const property::DatasetTransferList &dtpl =
+                      property::DatasetTransferList::get()):
+        PreparedTransfer<T>(dataset,selection,dtpl),
+        max_dims_(this->file_space_.maximum_dimensions())
+    {}
+
+    //!
+    //! \brief constructor
+    //!
+    //! Prepares writing the entire dataset.
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param dataset the dataset to write to
+    //! \param dtpl the dataset transfer property list
+    //!
+    PreparedWrite(const Dataset &dataset,
+                  const property::DatasetTransferList &dtpl =
+                      property::DatasetTransferList::get()):
+        PreparedTransfer<T>(dataset,dtpl),
+        max_dims_(this->file_space_.maximum_dimensions())
+    {}
+
+    //!
+    //! \brief write data to the current selection
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param data the data to write - must provide as many elements as
+    //!             selected
+    //!
+    void execute(const T &data) const
+    {
+      this->dataset_.write(data,this->mem_type_,this->mem_space_,
+                           this->file_space_,this->dtpl_);
+    }
+
+    //!
+    //! \brief append data along a dimension
+    //!
+    //! Writes data to the current selection and advances the selection
+    //! along the given dimension afterwards. The dataset is extended if the
+    //! selection exceeds its current extent.
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param data the data to write
+    //! \param dimension index of the dimension to append along
+    //!
+    void append(const T &data,size_t dimension = 0)
+    {
+      this->check_dimension(dimension);
+      hsize_t end = this->selection_.offset()[dimension] +
+                    this->selection_.dimensions()[dimension];
+      Dimensions dims = this->file_space_.current_dimensions();
+      if(end > dims[dimension])
+      {
+        dims[dimension] = end;
+        this->dataset_.resize(dims);
+        // update the cached file space instead of fetching a new one
+        this->file_space_.dimensions(dims,max_dims_);
+        this->file_space_.selection(dataspace::SelectionOperation::Set,
+                                    this->selection_);
+      }
+      execute(data);
+      this->advance(dimension);
+    }
+
+  private:
+    Dimensions max_dims_;
+};
+
+//!
+//! \brief prepared read operation
+//!
+//! A PreparedRead reads instances of T from a fixed selection of a dataset
+//! without setting up memory type, memory space and file space for every
+//! call. With advance() the selection can be moved through the dataset.
+//!
+//! \sa Dataset::prepare_read
+//!
+template<typename T>
+class PreparedRead : public PreparedTransfer<T>
+{
+  public:
+    //!
+    //! \brief constructor
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param dataset the dataset to read from
+    //! \param selection the part of the dataset to read
+    //! \param dtpl the dataset transfer property list
+    //!
+    PreparedRead(const Dataset &dataset,const dataspace::Hyperslab &selection,
+                 const property::DatasetTransferList &dtpl =
+                     property::DatasetTransferList::get()):
+        PreparedTransfer<T>(dataset,selection,dtpl)
+    {}
+
+    //!
+    //! \brief constructor
+    //!
+    //! Prepares reading the entire dataset.
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param dataset the dataset to read from
+    //! \param dtpl the dataset transfer property list
+    //!
+    PreparedRead(const Dataset &dataset,
+                 const property::DatasetTransferList &dtpl =
+                     property::DatasetTransferList::get()):
+        PreparedTransfer<T>(dataset,dtpl)
+    {}
+
+    //!
+    //! \brief read data from the current selection
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param data the destination - must provide space for as many
+    //!             elements as selected
+    //!
+    void execute(T &data) const
+    {
+      this->dataset_.read(data,this->mem_type_,this->mem_space_,
+                          this->file_space_,this->dtpl_);
+    }
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+template<typename T>
+PreparedWrite<T> Dataset::prepare_write(const dataspace::Hyperslab &selection,
+                                        const property::DatasetTransferList &dtpl) const
+{
+  return PreparedWrite<T>(*this,selection,dtpl);
+}
+
+template<typename T>
+PreparedWrite<T> Dataset::prepare_write(const property::DatasetTransferList &dtpl) const
+{
+  return PreparedWrite<T>(*this,dtpl);
+}
+
+template<typename T>
+PreparedRead<T> Dataset::prepare_read(const dataspace::Hyperslab &selection,
+                                      const property::DatasetTransferList &dtpl) const
+{
+  return PreparedRead<T>(*this,selection,dtpl);
+}
+
+template<typename T>
+PreparedRead<T> Dataset::prepare_read(const property::DatasetTransferList &dtpl) const
+{
+  return PreparedRead<T>(*this,dtpl);
+}
+
+} // namespace node
+} // namespace hdf5
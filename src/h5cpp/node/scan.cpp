@@ -0,0 +1,278 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <h5cpp/core/executor.hpp>
+#include <h5cpp/core/object_handle.hpp>
+#include <h5cpp/core/object_id.hpp>
+#include <h5cpp/core/thread_pool.hpp>
+#include <h5cpp/core/utilities.hpp>
+#include <h5cpp/error/error.hpp>
+#include <h5cpp/file/functions.hpp>
+#include <h5cpp/node/link_view.hpp>
+#include <h5cpp/node/scan.hpp>
+
+namespace hdf5 {
+namespace node {
+
+namespace {
+
+//
+// object header information required for the catalogue
+//
+#if H5_VERSION_GE(1,10,3)
+const unsigned info_fields = H5O_INFO_BASIC | H5O_INFO_NUM_ATTRS;
+#endif
+
+struct Visit
+{
+  std::string prefix;
+  size_t file;
+  bool dataset_details;
+  std::vector<CatalogueEntry> entries;
+  std::exception_ptr error;
+};
+
+void query_dataset(hid_t base,const char *name,CatalogueEntry &entry)
+{
+  ObjectHandle dataset(H5Dopen2(base,name,H5P_DEFAULT));
+  ObjectHandle space(H5Dget_space(static_cast<hid_t>(dataset)));
+  ObjectHandle type(H5Dget_type(static_cast<hid_t>(dataset)));
+
+  int rank = H5Sget_simple_extent_ndims(static_cast<hid_t>(space));
+  if(rank<0)
+    error::Singleton::instance().throw_with_stack(
+        "Failure retrieving the rank of dataset ["+entry.path+"]!");
+  entry.shape.resize(signed2unsigned<size_t>(rank));
+  if(rank>0 && H5Sget_simple_extent_dims(static_cast<hid_t>(space),
+                                         entry.shape.data(),nullptr)<0)
+    error::Singleton::instance().throw_with_stack(
+        "Failure retrieving the shape of dataset ["+entry.path+"]!");
+
+  H5T_class_t type_class = H5Tget_class(static_cast<hid_t>(type));
+  if(type_class==H5T_NO_CLASS)
+    error::Singleton::instance().throw_with_stack(
+        "Failure retrieving the datatype class of dataset ["+entry.path+"]!");
+  entry.datatype_class = static_cast<datatype::Class>(type_class);
+}
+
+void add_entry(hid_t base,const char *name,const H5O_info_t_ &info,
+               Visit &visit)
+{
+  CatalogueEntry entry{visit.prefix+name,
+                       visit.file,
+                       static_cast<Type>(info.type),
+                       info.addr,
+                       info.num_attrs,
+                       datatype::Class::None,
+                       Dimensions()};
+  if(visit.dataset_details && info.type==H5O_TYPE_DATASET)
+    query_dataset(base,name,entry);
+
+  visit.entries.push_back(std::move(entry));
+}
+
+herr_t visit_object(hid_t base,const char *name,const H5O_info_t_ *info,
+                    void *op_data)
+{
+  auto visit = static_cast<Visit*>(op_data);
+
+  // the group where the traversal starts is reported as "."
+  if(name[0]=='.' && name[1]=='\0')
+    return 0;
+
+  try
+  {
+    add_entry(base,name,*info,*visit);
+  }
+  catch(...)
+  {
+    // exceptions must not propagate through libhdf5
+    visit->error = std::current_exception();
+    return -1;
+  }
+  return 0;
+}
+
+void visit_group(hid_t group,Visit &visit)
+{
+#if H5_VERSION_GE(1,10,3)
+  herr_t status = H5Ovisit2(group,H5_INDEX_NAME,H5_ITER_INC,visit_object,
+                            &visit,info_fields);
+#else
+  herr_t status = H5Ovisit(group,H5_INDEX_NAME,H5_ITER_INC,visit_object,
+                           &visit);
+#endif
+  if(visit.error)
+    std::rethrow_exception(visit.error);
+  if(status<0)
+    error::Singleton::instance().throw_with_stack(
+        "Failure traversing the objects below ["+visit.prefix+"]!");
+}
+
+//
+// catalogue a direct child of a group and the tree below it
+//
+std::vector<CatalogueEntry> scan_child(const Group &group,
+                                       const std::string &name,
+                                       size_t file,
+                                       const ScanOptions &options)
+{
+  return concurrency::Executor::instance().run([&]()
+  {
+    std::string parent = static_cast<std::string>(group.link().path());
+    if(parent.back()!='/')
+      parent += "/";
+    Visit visit{parent,file,options.dataset_details,{},nullptr};
+
+    H5O_info_t_ info;
+#if H5_VERSION_GE(1,10,3)
+    herr_t status = H5Oget_info_by_name2(static_cast<hid_t>(group),
+                                         name.c_str(),&info,info_fields,
+                                         H5P_DEFAULT);
+#else
+    herr_t status = H5Oget_info_by_name(static_cast<hid_t>(group),
+                                        name.c_str(),&info,H5P_DEFAULT);
+#endif
+    if(status<0)
+      error::Singleton::instance().throw_with_stack(
+          "Failure retrieving the object info of ["+parent+name+"]!");
+
+    add_entry(static_cast<hid_t>(group),name.c_str(),info,visit);
+    if(info.type==H5O_TYPE_GROUP)
+    {
+      ObjectHandle child(H5Gopen2(static_cast<hid_t>(group),name.c_str(),
+                                  H5P_DEFAULT));
+      visit.prefix = parent+name+"/";
+      visit_group(static_cast<hid_t>(child),visit);
+    }
+    return std::move(visit.entries);
+  });
+}
+
+std::vector<CatalogueEntry> scan_file(const fs::path &path,size_t file,
+                                      const ScanOptions &options)
+{
+  return concurrency::Executor::instance().run([&]()
+  {
+    auto root = file::open(path).root();
+    Visit visit{"/",file,options.dataset_details,{},nullptr};
+    visit_group(static_cast<hid_t>(root),visit);
+    return std::move(visit.entries);
+  });
+}
+
+size_t pool_size(const ScanOptions &options,size_t tasks)
+{
+  size_t threads = options.threads;
+  if(threads==0)
+    threads = std::thread::hardware_concurrency();
+  return std::max<size_t>(1,std::min(threads,tasks));
+}
+
+//
+// collect the results of the tasks in submission order dropping objects
+// already reached via another hard link of the same file
+//
+void collect(std::vector<std::future<std::vector<CatalogueEntry>>> &tasks,
+             Catalogue &catalogue)
+{
+  std::exception_ptr error;
+  std::unordered_set<haddr_t> seen;
+  size_t file = 0;
+  for(auto &task: tasks)
+  {
+    try
+    {
+      for(auto &entry: task.get())
+      {
+        if(entry.file!=file)
+        {
+          file = entry.file;
+          seen.clear();
+        }
+        if(seen.insert(entry.address).second)
+          catalogue.entries.push_back(std::move(entry));
+      }
+    }
+    catch(...)
+    {
+      // wait for all tasks before reporting the first failure
+      if(!error)
+        error = std::current_exception();
+    }
+  }
+  if(error)
+    std::rethrow_exception(error);
+}
+
+} // anonymous namespace
+
+Catalogue scan(const Group &group,const ScanOptions &options)
+{
+  Catalogue catalogue;
+  catalogue.files.push_back(group.link().file().path());
+
+  LinkListing listing = concurrency::Executor::instance().run([&]()
+  { return group.links.list(); });
+
+  std::vector<std::string> children;
+  for(const auto &entry: listing)
+    if(entry.type==LinkType::Hard)
+      children.push_back(entry.name);
+
+  ThreadPool pool(pool_size(options,children.size()));
+  std::vector<std::future<std::vector<CatalogueEntry>>> tasks;
+  for(const auto &name: children)
+    tasks.push_back(pool.submit([&group,&options,name]()
+    { return scan_child(group,name,0,options); }));
+
+  collect(tasks,catalogue);
+  return catalogue;
+}
+
+Catalogue scan(const std::vector<fs::path> &files,const ScanOptions &options)
+{
+  Catalogue catalogue;
+  catalogue.files = files;
+
+  ThreadPool pool(pool_size(options,files.size()));
+  std::vector<std::future<std::vector<CatalogueEntry>>> tasks;
+  for(size_t index = 0; index < files.size(); ++index)
+    tasks.push_back(pool.submit([&files,&options,index]()
+    { return scan_file(files[index],index,options); }));
+
+  collect(tasks,catalogue);
+  return catalogue;
+}
+
+} // namespace node
+} // namespace hdf5
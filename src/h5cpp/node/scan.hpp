@@ -0,0 +1,172 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <h5cpp/core/filesystem.hpp>
+#include <h5cpp/core/hdf5_capi.hpp>
+#include <h5cpp/core/types.hpp>
+#include <h5cpp/core/windows.hpp>
+#include <h5cpp/datatype/types.hpp>
+#include <h5cpp/node/group.hpp>
+#include <h5cpp/node/types.hpp>
+
+namespace hdf5 {
+namespace node {
+
+//!
+//! \brief options for scan()
+//!
+struct ScanOptions
+{
+  //!
+  //! \brief number of worker threads - if 0 the number of hardware
+  //!        threads is used
+  //!
+  size_t threads = 0;
+
+  //!
+  //! \brief query shape and datatype class of datasets
+  //!
+  //! This requires opening every dataset. If disabled only the information
+  //! stored in the object headers is collected.
+  //!
+  bool dataset_details = true;
+};
+
+//!
+//! \brief catalogue entry describing a single object
+//!
+struct CatalogueEntry
+{
+  //!
+  //! \brief absolute path of the object within its file
+  //!
+  //! If an object is reachable via several hard links only the first path
+  //! found is recorded.
+  //!
+  std::string path;
+
+  //!
+  //! \brief index of the file in Catalogue::files
+  //!
+  size_t file;
+
+  //!
+  //! \brief type of the object
+  //!
+  Type type;
+
+  //!
+  //! \brief address of the object in the file
+  //!
+  haddr_t address;
+
+  //!
+  //! \brief number of attributes attached to the object
+  //!
+  hsize_t attributes;
+
+  //!
+  //! \brief datatype class of a dataset
+  //!
+  //! datatype::Class::None for all other objects or if the dataset
+  //! details have not been requested.
+  //!
+  datatype::Class datatype_class;
+
+  //!
+  //! \brief current dimensions of a dataset
+  //!
+  //! Empty for scalar datasets, all other objects or if the dataset
+  //! details have not been requested.
+  //!
+  Dimensions shape;
+};
+
+//!
+//! \brief flat catalogue of the objects in one or more files
+//!
+//! The entries of a file are stored consecutively in the order of the
+//! scan.
+//!
+struct Catalogue
+{
+  //!
+  //! \brief the scanned files
+  //!
+  std::vector<fs::path> files;
+
+  //!
+  //! \brief one entry per object
+  //!
+  std::vector<CatalogueEntry> entries;
+};
+
+//!
+//! \brief catalogue all objects below a group
+//!
+//! Traverses the tree below group with H5Ovisit and records the
+//! information available from the object headers without constructing
+//! Node instances. Every direct child group is traversed as a separate
+//! task on a pool of worker threads. Soft and external links are not
+//! followed. The group itself is not part of the catalogue.
+//!
+//! All HDF5 calls are issued through concurrency::Executor. As libhdf5
+//! serializes all calls internally, the threads mainly overlap the
+//! assembly of the catalogue with the traversal.
+//!
+//! \code
+//! auto catalogue = node::scan(file.root());
+//! for(const auto &entry: catalogue.entries)
+//!   if(entry.type == node::Type::Dataset)
+//!     std::cout<<entry.path<<std::endl;
+//! \endcode
+//!
+//! \throws std::runtime_error in case of a failure
+//! \param group the group to scan
+//! \param options scan options
+//! \return catalogue with a single file
+//!
+DLL_EXPORT Catalogue scan(const Group &group,
+                          const ScanOptions &options = ScanOptions());
+
+//!
+//! \brief catalogue all objects in several files
+//!
+//! Every file is opened read-only and scanned as a separate task on a pool
+//! of worker threads. The entries for each file start at its root group.
+//!
+//! \throws std::runtime_error in case of a failure
+//! \param files the files to scan
+//! \param options scan options
+//! \return catalogue of all files
+//!
+DLL_EXPORT Catalogue scan(const std::vector<fs::path> &files,
+                          const ScanOptions &options = ScanOptions());
+
+} // namespace node
+} // namespace hdf5
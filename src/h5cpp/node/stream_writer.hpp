@@ -0,0 +1,381 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <h5cpp/core/types.hpp>
+#include <h5cpp/dataspace/hyperslab.hpp>
+#include <h5cpp/dataspace/simple.hpp>
+#include <h5cpp/datatype/type_cache.hpp>
+#include <h5cpp/node/dataset.hpp>
+#include <h5cpp/property/dataset_transfer.hpp>
+
+namespace hdf5 {
+namespace node {
+
+//!
+//! \brief buffered frame writer for extensible datasets
+//!
+//! A StreamWriter appends frames - slabs of the dataset with extent 1 along
+//! the first dimension - to a chunked dataset. Instead of extending the
+//! dataset and writing a hyperslab for every frame, frames are collected in
+//! a staging buffer whose size is a multiple of the chunk size along the
+//! first dimension. The buffer is written as a whole once it is full, so
+//! libhdf5 receives whole chunks. The extent of the dataset grows in
+//! geometric steps (it is doubled, rounded up to a chunk boundary and
+//! capped at the maximum extent) which keeps the number of metadata updates
+//! logarithmic in the number of frames. close() writes the remaining frames
+//! and trims the extent to the number of frames actually written.
+//!
+//! Writing starts after the data already stored in the dataset. The
+//! elements are converted from T to the file type by libhdf5 if necessary.
+//!
+//! \code
+//! node::StreamWriter<float> writer(dataset);
+//! for(const auto &frame: frames)
+//!   writer.write(frame);
+//! writer.close();
+//! \endcode
+//!
+//! \tparam T element type of the frames in memory
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+template<typename T>
+class StreamWriter
+{
+  public:
+    //!
+    //! \brief constructor
+    //!
+    //! \throws std::runtime_error if the dataset is not chunked or uses a
+    //!         variable length type
+    //! \param dataset the dataset to append to
+    //! \param frames_per_flush number of frames buffered before they are
+    //!                         written - rounded up to a multiple of the
+    //!                         chunk size along the first dimension. If 0
+    //!                         the chunk size is used.
+    //! \param dtpl dataset transfer property list used for writing
+    //!
+    StreamWriter(const Dataset &dataset,size_t frames_per_flush = 0,
+                 const property::DatasetTransferList &dtpl =
+                     property::DatasetTransferList::get());
+
+    //!
+    //! \brief destructor
+    //!
+    //! Closes the writer if close() has not been called. Errors are
+    //! swallowed - call close() explicitly to see them.
+    //!
+    ~StreamWriter();
+
+    StreamWriter(const StreamWriter &) = delete;
+    StreamWriter &operator=(const StreamWriter &) = delete;
+
+    //!
+    //! \brief get the dataset
+    //!
+    const Dataset &dataset() const noexcept
+    {
+      return dataset_;
+    }
+
+    //!
+    //! \brief number of elements of a single frame
+    //!
+    size_t frame_size() const noexcept
+    {
+      return frame_size_;
+    }
+
+    //!
+    //! \brief number of frames written or buffered
+    //!
+    //! Includes the frames stored in the dataset before the writer was
+    //! created.
+    //!
+    hsize_t frames() const noexcept
+    {
+      return written_ + buffered_;
+    }
+
+    //!
+    //! \brief number of frames in the staging buffer
+    //!
+    size_t buffered() const noexcept
+    {
+      return buffered_;
+    }
+
+    //!
+    //! \brief capacity of the staging buffer in frames
+    //!
+    size_t frames_per_flush() const noexcept
+    {
+      return frames_per_flush_;
+    }
+
+    //!
+    //! \brief true if the writer has been closed
+    //!
+    bool is_closed() const noexcept
+    {
+      return closed_;
+    }
+
+    //!
+    //! \brief append frames
+    //!
+    //! \throws std::runtime_error if the writer is closed, frames is not a
+    //!         multiple of frame_size() or writing fails
+    //! \param data pointer to the elements of the frames
+    //! \param frames number of frames
+    //!
+    void write(const T *data,size_t frames = 1);
+
+    //!
+    //! \brief append frames
+    //!
+    //! The number of elements must be a multiple of frame_size().
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param data elements of one or more frames
+    //!
+    void write(const std::vector<T> &data);
+
+    //!
+    //! \brief write the buffered frames to the dataset
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //!
+    void flush();
+
+    //!
+    //! \brief flush and trim the dataset
+    //!
+    //! Writes the buffered frames and shrinks the extent of the dataset to
+    //! frames(). Calling close() on a closed writer has no effect.
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //!
+    void close();
+
+  private:
+    void check_open() const;
+    void reserve(hsize_t frames);
+
+    Dataset dataset_;
+    property::DatasetTransferList dtpl_;
+    datatype::Datatype mem_type_;
+    Dimensions dims_;
+    hsize_t max_frames_;
+    hsize_t chunk_frames_;
+    size_t frame_size_;
+    size_t frames_per_flush_;
+    std::vector<T> buffer_;
+    size_t buffered_;
+    hsize_t written_;
+    dataspace::Simple mem_space_;
+    dataspace::Simple file_space_;
+    dataspace::Hyperslab selection_;
+    bool closed_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+template<typename T>
+StreamWriter<T>::StreamWriter(const Dataset &dataset,size_t frames_per_flush,
+                              const property::DatasetTransferList &dtpl):
+    dataset_(dataset),
+    dtpl_(dtpl),
+    mem_type_(datatype::TypeCache::instance().get<T>()),
+    dims_(),
+    max_frames_(0),
+    chunk_frames_(0),
+    frame_size_(1),
+    frames_per_flush_(0),
+    buffer_(),
+    buffered_(0),
+    written_(0),
+    mem_space_(),
+    file_space_(dataset.dataspace()),
+    selection_(),
+    closed_(false)
+{
+  auto dcpl = dataset.creation_list();
+  if(dcpl.layout() != property::DatasetLayout::Chunked)
+  {
+    std::stringstream ss;
+    ss<<"Dataset ["<<dataset.link().path()<<"] is not chunked!";
+    throw std::runtime_error(ss.str());
+  }
+  if(!datatype::is_fixed_size(dataset.datatype()))
+  {
+    std::stringstream ss;
+    ss<<"Dataset ["<<dataset.link().path()<<"] has a variable length type"
+      <<" which cannot be streamed!";
+    throw std::runtime_error(ss.str());
+  }
+
+  dims_ = file_space_.current_dimensions();
+  max_frames_ = file_space_.maximum_dimensions()[0];
+  chunk_frames_ = dcpl.chunk()[0];
+  for(size_t d = 1; d < dims_.size(); ++d)
+    frame_size_ *= static_cast<size_t>(dims_[d]);
+
+  if(frames_per_flush == 0) frames_per_flush = static_cast<size_t>(chunk_frames_);
+  frames_per_flush_ = static_cast<size_t>(
+      (frames_per_flush + chunk_frames_ - 1) / chunk_frames_ * chunk_frames_);
+  buffer_.resize(frames_per_flush_ * frame_size_);
+  written_ = dims_[0];
+
+  Dimensions block(dims_);
+  block[0] = frames_per_flush_;
+  mem_space_ = dataspace::Simple(block);
+  selection_ = dataspace::Hyperslab(Dimensions(dims_.size(),0),block);
+}
+
+template<typename T>
+StreamWriter<T>::~StreamWriter()
+{
+  try
+  {
+    close();
+  }
+  catch(...)
+  {}
+}
+
+template<typename T>
+void StreamWriter<T>::check_open() const
+{
+  if(closed_)
+  {
+    std::stringstream ss;
+    ss<<"StreamWriter for dataset ["<<dataset_.link().path()<<"] is closed!";
+    throw std::runtime_error(ss.str());
+  }
+}
+
+template<typename T>
+void StreamWriter<T>::write(const T *data,size_t frames)
+{
+  check_open();
+  while(frames > 0)
+  {
+    size_t n = std::min(frames,frames_per_flush_ - buffered_);
+    std::copy(data,data + n * frame_size_,
+              buffer_.begin() + static_cast<std::ptrdiff_t>(buffered_ * frame_size_));
+    buffered_ += n;
+    data += n * frame_size_;
+    frames -= n;
+    if(buffered_ == frames_per_flush_) flush();
+  }
+}
+
+template<typename T>
+void StreamWriter<T>::write(const std::vector<T> &data)
+{
+  if(frame_size_ == 0 || data.size() % frame_size_ != 0)
+  {
+    std::stringstream ss;
+    ss<<"Number of elements ("<<data.size()<<") is not a multiple of the"
+      <<" frame size ("<<frame_size_<<")!";
+    throw std::runtime_error(ss.str());
+  }
+  write(data.data(),data.size() / frame_size_);
+}
+
+template<typename T>
+void StreamWriter<T>::reserve(hsize_t frames)
+{
+  if(frames <= dims_[0]) return;
+
+  if(max_frames_ != dataspace::Simple::unlimited && frames > max_frames_)
+  {
+    std::stringstream ss;
+    ss<<"Cannot append "<<frames - written_<<" frames to dataset ["
+      <<dataset_.link().path()<<"] - the maximum extent is "<<max_frames_<<"!";
+    throw std::runtime_error(ss.str());
+  }
+
+  hsize_t extent = std::max(frames,2 * dims_[0]);
+  extent = (extent + chunk_frames_ - 1) / chunk_frames_ * chunk_frames_;
+  if(max_frames_ != dataspace::Simple::unlimited)
+    extent = std::min(extent,max_frames_);
+
+  Dimensions dims(dims_);
+  dims[0] = extent;
+  dataset_.resize(dims);
+  dims_ = dims;
+  file_space_.dimensions(dims_,file_space_.maximum_dimensions());
+}
+
+template<typename T>
+void StreamWriter<T>::flush()
+{
+  check_open();
+  if(buffered_ == 0) return;
+
+  reserve(written_ + buffered_);
+  selection_.offset(0,written_);
+  if(buffered_ == frames_per_flush_)
+  {
+    file_space_.selection(dataspace::SelectionOperation::Set,selection_);
+    dataset_.write(buffer_,mem_type_,mem_space_,file_space_,dtpl_);
+  }
+  else
+  {
+    Dimensions block = selection_.block();
+    block[0] = buffered_;
+    dataspace::Hyperslab selection(selection_.offset(),block);
+    file_space_.selection(dataspace::SelectionOperation::Set,selection);
+    dataset_.write(buffer_,mem_type_,dataspace::Simple(block),file_space_,dtpl_);
+  }
+  written_ += buffered_;
+  buffered_ = 0;
+}
+
+template<typename T>
+void StreamWriter<T>::close()
+{
+  if(closed_) return;
+
+  flush();
+  if(dims_[0] != written_)
+  {
+    dims_[0] = written_;
+    dataset_.resize(dims_);
+  }
+  closed_ = true;
+}
+
+} // namespace node
+} // namespace hdf5
@@ -0,0 +1,232 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+
+#include <algorithm>
+#include <cstring>
+#include <h5cpp/core/executor.hpp>
+#include <h5cpp/dataspace/simple.hpp>
+#include <h5cpp/error/error.hpp>
+#include <h5cpp/node/write_behind_dataset.hpp>
+
+namespace hdf5 {
+namespace node {
+
+WriteBehindDataset::WriteBehindDataset(const Dataset &dataset,size_t budget):
+    dataset_(dataset),
+    worker_dataset_(dataset),
+    budget_(budget),
+    mutex_(),
+    released_(),
+    pool_(),
+    pooled_bytes_(0),
+    failure_(),
+    metrics_(),
+    total_latency_(0),
+    queue_(nullptr)
+{
+  if(!dataset_.is_valid())
+  {
+    throw std::runtime_error("Cannot create a WriteBehindDataset from an invalid dataset!");
+  }
+  if(budget_ == 0)
+  {
+    throw std::runtime_error("The memory budget of a WriteBehindDataset must not be 0!");
+  }
+  queue_.reset(new TaskQueue());
+}
+
+WriteBehindDataset::~WriteBehindDataset()
+{
+  // drains the queue and joins the worker before the datasets are released
+  queue_.reset();
+}
+
+const Dataset &WriteBehindDataset::dataset() const noexcept
+{
+  return dataset_;
+}
+
+size_t WriteBehindDataset::budget() const noexcept
+{
+  return budget_;
+}
+
+void WriteBehindDataset::rethrow_failure()
+{
+  // must be called with the mutex locked
+  if(failure_)
+  {
+    std::exception_ptr failure = failure_;
+    failure_ = nullptr;
+    std::rethrow_exception(failure);
+  }
+}
+
+WriteBehindDataset::Buffer WriteBehindDataset::acquire(size_t bytes)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  rethrow_failure();
+  if(metrics_.pending_bytes + bytes > budget_)
+  {
+    ++metrics_.stalls;
+    released_.wait(lock,[this,bytes]()
+                   { return failure_ || metrics_.pending_bytes + bytes <= budget_; });
+    rethrow_failure();
+  }
+
+  metrics_.pending_bytes += bytes;
+  metrics_.max_pending_bytes = std::max(metrics_.max_pending_bytes,metrics_.pending_bytes);
+  ++metrics_.queue_depth;
+  metrics_.max_queue_depth = std::max(metrics_.max_queue_depth,metrics_.queue_depth);
+
+  // prefer the smallest pooled buffer which is large enough
+  auto best = pool_.end();
+  for(auto iter = pool_.begin(); iter != pool_.end(); ++iter)
+  {
+    if(iter->capacity() >= bytes &&
+       (best == pool_.end() || iter->capacity() < best->capacity()))
+      best = iter;
+  }
+  if(best == pool_.end() && !pool_.empty())
+    best = pool_.begin();
+
+  Buffer buffer;
+  if(best != pool_.end())
+  {
+    pooled_bytes_ -= best->capacity();
+    buffer = std::move(*best);
+    pool_.erase(best);
+  }
+  lock.unlock();
+
+  buffer.resize(bytes);
+  return buffer;
+}
+
+void WriteBehindDataset::release(Buffer &&buffer,size_t bytes,
+                                 std::chrono::steady_clock::time_point queued)
+{
+  auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - queued);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    metrics_.pending_bytes -= bytes;
+    --metrics_.queue_depth;
+    ++metrics_.drained;
+    total_latency_ += latency;
+    metrics_.max_drain_latency = std::max(metrics_.max_drain_latency,latency);
+
+    // the pool never holds more memory than the budget
+    if(pooled_bytes_ + buffer.capacity() <= budget_)
+    {
+      pooled_bytes_ += buffer.capacity();
+      pool_.push_back(std::move(buffer));
+    }
+  }
+  released_.notify_all();
+}
+
+void WriteBehindDataset::enqueue(const void *data,size_t bytes,
+                                 TypeFactory &&mem_type,
+                                 const dataspace::Hyperslab &selection)
+{
+  if(bytes > budget_)
+  {
+    std::stringstream ss;
+    ss<<"Write of "<<bytes<<" bytes exceeds the memory budget ("<<budget_
+      <<" bytes) of dataset ["<<dataset_.link().path()<<"]!";
+    throw std::runtime_error(ss.str());
+  }
+
+  Buffer buffer = acquire(bytes);
+  if(bytes) std::memcpy(buffer.data(),data,bytes);
+  auto queued = std::chrono::steady_clock::now();
+
+  Dataset &dataset = worker_dataset_;
+  queue_->submit([this,&dataset,buffer = std::move(buffer),bytes,queued,
+                  mem_type = std::move(mem_type),selection]() mutable
+  {
+    try
+    {
+      concurrency::Executor::instance().run([&]()
+      {
+        dataspace::Simple mem_space{{static_cast<hsize_t>(selection.size())}};
+        auto file_space = dataset.dataspace();
+        file_space.selection(dataspace::SelectionOperation::Set,selection);
+        if(H5Dwrite(static_cast<hid_t>(dataset),static_cast<hid_t>(mem_type()),
+                    static_cast<hid_t>(mem_space),static_cast<hid_t>(file_space),
+                    H5P_DEFAULT,buffer.data())<0)
+        {
+          std::stringstream ss;
+          ss<<"Failure to drain buffered data to dataset ["
+            <<dataset.link().path()<<"]!";
+          error::Singleton::instance().throw_with_stack(ss.str());
+        }
+      });
+    }
+    catch(...)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if(!failure_) failure_ = std::current_exception();
+    }
+    release(std::move(buffer),bytes,queued);
+  });
+}
+
+void WriteBehindDataset::flush()
+{
+  queue_->wait();
+  std::lock_guard<std::mutex> lock(mutex_);
+  rethrow_failure();
+}
+
+void WriteBehindDataset::flush(file::Scope scope)
+{
+  flush();
+  Dataset &dataset = worker_dataset_;
+  queue_->submit([&dataset,scope]()
+  {
+    concurrency::Executor::instance().run([&]()
+    {
+      if(H5Fflush(static_cast<hid_t>(dataset),static_cast<H5F_scope_t>(scope))<0)
+      {
+        std::stringstream ss;
+        ss<<"Failure to flush the file of dataset ["<<dataset.link().path()<<"]!";
+        error::Singleton::instance().throw_with_stack(ss.str());
+      }
+    });
+  }).get();
+}
+
+WriteBehindMetrics WriteBehindDataset::metrics() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  WriteBehindMetrics metrics = metrics_;
+  if(metrics.drained)
+    metrics.mean_drain_latency = total_latency_ / static_cast<long>(metrics.drained);
+  return metrics;
+}
+
+} // namespace node
+} // namespace hdf5
@@ -0,0 +1,248 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <h5cpp/core/task_queue.hpp>
+#include <h5cpp/core/windows.hpp>
+#include <h5cpp/dataspace/hyperslab.hpp>
+#include <h5cpp/datatype/type_cache.hpp>
+#include <h5cpp/file/types.hpp>
+#include <h5cpp/node/dataset.hpp>
+
+namespace hdf5 {
+namespace node {
+
+//!
+//! \brief statistics of a write-behind dataset
+//!
+struct DLL_EXPORT WriteBehindMetrics
+{
+  //! number of writes queued or being drained
+  size_t queue_depth;
+  //! largest queue depth observed
+  size_t max_queue_depth;
+  //! number of bytes held by queued writes
+  size_t pending_bytes;
+  //! largest number of bytes held by queued writes
+  size_t max_pending_bytes;
+  //! number of writes drained to the dataset
+  size_t drained;
+  //! number of writes which had to wait for memory to become available
+  size_t stalls;
+  //! mean time between queueing a write and its completion
+  std::chrono::nanoseconds mean_drain_latency;
+  //! longest time between queueing a write and its completion
+  std::chrono::nanoseconds max_drain_latency;
+};
+
+//!
+//! \brief write-behind buffering for a dataset
+//!
+//! Writes to a WriteBehindDataset return as soon as the data has been
+//! copied into a staging buffer. A background thread drains the buffers to
+//! the dataset in the order in which they were written. This absorbs
+//! bursts of writes which are faster than the storage for a short time.
+//!
+//! The memory used for staging is bounded by a budget. A write which does
+//! not fit into the remaining budget blocks until enough queued writes have
+//! been drained (backpressure). Drained buffers are kept in a pool and
+//! reused by later writes, so that no memory is allocated once the pool
+//! has warmed up.
+//!
+//! A failure on the background thread is reported by the next call to
+//! write() or flush().
+//!
+//! \code
+//! node::WriteBehindDataset buffered(dataset,64*1024*1024);
+//! for(size_t index=0; index<frames; ++index)
+//!   buffered.write(acquire_frame(),dataspace::Hyperslab{{index,0,0},{1,ny,nx}});
+//! buffered.flush(file::Scope::Global);
+//! \endcode
+//!
+//! All HDF5 calls of write() and flush() are issued by the background
+//! thread via concurrency::Executor - the writing thread only copies data.
+//! The constructor and the destructor copy and release dataset handles on
+//! the calling thread. Unless libhdf5 is built thread-safe the writing
+//! thread must not issue other HDF5 calls while writes are pending, except
+//! through the Executor.
+//!
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+class DLL_EXPORT WriteBehindDataset
+{
+  public:
+    //!
+    //! \brief constructor
+    //!
+    //! The dataset must have been extended to hold all selections written
+    //! before they are written.
+    //!
+    //! \throws std::runtime_error if the dataset is not valid or the budget
+    //!         is 0
+    //! \param dataset the dataset to write to
+    //! \param budget maximum number of bytes held by queued writes
+    //!
+    WriteBehindDataset(const Dataset &dataset,size_t budget);
+
+    //!
+    //! \brief destructor
+    //!
+    //! Drains all queued writes. Failures are not reported - call flush()
+    //! before to see them.
+    //!
+    ~WriteBehindDataset();
+
+    WriteBehindDataset(const WriteBehindDataset &) = delete;
+    WriteBehindDataset &operator=(const WriteBehindDataset &) = delete;
+
+    //!
+    //! \brief get the dataset
+    //!
+    const Dataset &dataset() const noexcept;
+
+    //!
+    //! \brief the memory budget in bytes
+    //!
+    size_t budget() const noexcept;
+
+    //!
+    //! \brief queue a write
+    //!
+    //! \throws std::runtime_error if the number of elements does not match
+    //!         the selection, the data exceeds the budget or a previous
+    //!         write has failed
+    //! \tparam T element type
+    //! \param data the elements to write
+    //! \param selection hyperslab in the dataset to write to
+    //!
+    template<typename T>
+    void write(const std::vector<T> &data,const dataspace::Hyperslab &selection);
+
+    //!
+    //! \brief queue a write
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \tparam T element type
+    //! \param data pointer to selection.size() elements
+    //! \param selection hyperslab in the dataset to write to
+    //!
+    template<typename T>
+    void write(const T *data,const dataspace::Hyperslab &selection);
+
+    //!
+    //! \brief wait until all queued writes have been drained
+    //!
+    //! \throws std::runtime_error if a write has failed
+    //!
+    void flush();
+
+    //!
+    //! \brief drain all queued writes and flush the file
+    //!
+    //! \throws std::runtime_error in case of a failure
+    //! \param scope the scope of the file flush
+    //!
+    void flush(file::Scope scope);
+
+    //!
+    //! \brief get the current statistics
+    //!
+    WriteBehindMetrics metrics() const;
+
+  private:
+    using Buffer = std::vector<unsigned char>;
+    using TypeFactory = std::function<datatype::Datatype()>;
+
+    void enqueue(const void *data,size_t bytes,TypeFactory &&mem_type,
+                 const dataspace::Hyperslab &selection);
+    Buffer acquire(size_t bytes);
+    void release(Buffer &&buffer,size_t bytes,
+                 std::chrono::steady_clock::time_point queued);
+    void rethrow_failure();
+
+    Dataset dataset_;
+    //! the instance used exclusively on the worker thread
+    Dataset worker_dataset_;
+    size_t budget_;
+    mutable std::mutex mutex_;
+    std::condition_variable released_;
+    std::vector<Buffer> pool_;
+    size_t pooled_bytes_;
+    std::exception_ptr failure_;
+    WriteBehindMetrics metrics_;
+    std::chrono::nanoseconds total_latency_;
+    std::unique_ptr<TaskQueue> queue_;
+};
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+template<typename T>
+void WriteBehindDataset::write(const std::vector<T> &data,
+                               const dataspace::Hyperslab &selection)
+{
+  if(data.size() != selection.size())
+  {
+    std::stringstream ss;
+    ss<<"Number of elements ("<<data.size()<<") does not match the size of"
+      <<" the selection ("<<selection.size()<<")!";
+    throw std::runtime_error(ss.str());
+  }
+  write(data.data(),selection);
+}
+
+template<typename T>
+void WriteBehindDataset::write(const T *data,const dataspace::Hyperslab &selection)
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "Only trivially copyable types can be written behind!");
+
+  // the memory type is created on the worker thread like all HDF5 objects
+  enqueue(data,selection.size() * sizeof(T),
+          []() { return datatype::TypeCache::instance().get<T>(); },
+          selection);
+}
+
+} // namespace node
+} // namespace hdf5
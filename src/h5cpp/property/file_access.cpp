@@ -64,6 +64,90 @@ std::ostream &operator<<(std::ostream &stream, const CloseDegree &version) {
   return stream;
 }
 
+std::ostream &operator<<(std::ostream &stream, const AccessProfile &profile) {
+  switch (profile) {
+    case AccessProfile::ManySmallObjects: return stream << "MANY_SMALL_OBJECTS";
+    case AccessProfile::LargeSequentialDatasets: return stream << "LARGE_SEQUENTIAL_DATASETS";
+  }
+  return stream;
+}
+
+MetadataCacheConfig::MetadataCacheConfig() :
+    config_() {
+  config_.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+  if (H5Pget_mdc_config(H5P_FILE_ACCESS_DEFAULT, &config_) < 0) {
+    error::Singleton::instance().throw_with_stack("Failure retrieving the default metadata cache configuration!");
+  }
+}
+
+MetadataCacheConfig::MetadataCacheConfig(const H5AC_cache_config_t &config) noexcept :
+    config_(config) {}
+
+void MetadataCacheConfig::initial_size(size_t size) noexcept {
+  config_.set_initial_size = true;
+  config_.initial_size = size;
+}
+
+size_t MetadataCacheConfig::initial_size() const noexcept {
+  return config_.initial_size;
+}
+
+void MetadataCacheConfig::min_size(size_t size) noexcept {
+  config_.min_size = size;
+}
+
+size_t MetadataCacheConfig::min_size() const noexcept {
+  return config_.min_size;
+}
+
+void MetadataCacheConfig::max_size(size_t size) noexcept {
+  config_.max_size = size;
+}
+
+size_t MetadataCacheConfig::max_size() const noexcept {
+  return config_.max_size;
+}
+
+void MetadataCacheConfig::adaptive(bool value) noexcept {
+  if (value) {
+    config_.incr_mode = H5C_incr__threshold;
+    config_.flash_incr_mode = H5C_flash_incr__add_space;
+    config_.decr_mode = H5C_decr__age_out_with_threshold;
+  } else {
+    config_.incr_mode = H5C_incr__off;
+    config_.flash_incr_mode = H5C_flash_incr__off;
+    config_.decr_mode = H5C_decr__off;
+  }
+}
+
+bool MetadataCacheConfig::adaptive() const noexcept {
+  return config_.incr_mode != H5C_incr__off || config_.decr_mode != H5C_decr__off;
+}
+
+void MetadataCacheConfig::min_clean_fraction(double value) noexcept {
+  config_.min_clean_fraction = value;
+}
+
+double MetadataCacheConfig::min_clean_fraction() const noexcept {
+  return config_.min_clean_fraction;
+}
+
+void MetadataCacheConfig::evictions_enabled(bool value) noexcept {
+  config_.evictions_enabled = value;
+}
+
+bool MetadataCacheConfig::evictions_enabled() const noexcept {
+  return config_.evictions_enabled;
+}
+
+const H5AC_cache_config_t &MetadataCacheConfig::native() const noexcept {
+  return config_;
+}
+
+H5AC_cache_config_t &MetadataCacheConfig::native() noexcept {
+  return config_;
+}
+
 FileAccessList::FileAccessList() :
     List(kFileAccess) {}
 
@@ -127,5 +211,142 @@ void FileAccessList::driver(const file::Driver &file_driver) const {
   file_driver(*this);
 }
 
+void FileAccessList::metadata_cache_config(const MetadataCacheConfig &config) const {
+  // the list keeps a copy, the library only reads the structure
+  auto native = config.native();
+  if (0 > H5Pset_mdc_config(static_cast<hid_t>(*this), &native)) {
+    error::Singleton::instance().throw_with_stack("Failure setting the metadata cache configuration!");
+  }
+}
+
+MetadataCacheConfig FileAccessList::metadata_cache_config() const {
+  H5AC_cache_config_t config;
+  config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+  if (0 > H5Pget_mdc_config(static_cast<hid_t>(*this), &config)) {
+    error::Singleton::instance().throw_with_stack("Failure retrieving the metadata cache configuration!");
+  }
+  return MetadataCacheConfig(config);
+}
+
+void FileAccessList::meta_block_size(hsize_t size) const {
+  if (0 > H5Pset_meta_block_size(static_cast<hid_t>(*this), size)) {
+    error::Singleton::instance().throw_with_stack("Failure setting the metadata block size!");
+  }
+}
+
+hsize_t FileAccessList::meta_block_size() const {
+  hsize_t size = 0;
+  if (0 > H5Pget_meta_block_size(static_cast<hid_t>(*this), &size)) {
+    error::Singleton::instance().throw_with_stack("Failure retrieving the metadata block size!");
+  }
+  return size;
+}
+
+void FileAccessList::sieve_buffer_size(size_t size) const {
+  if (0 > H5Pset_sieve_buf_size(static_cast<hid_t>(*this), size)) {
+    error::Singleton::instance().throw_with_stack("Failure setting the sieve buffer size!");
+  }
+}
+
+size_t FileAccessList::sieve_buffer_size() const {
+  size_t size = 0;
+  if (0 > H5Pget_sieve_buf_size(static_cast<hid_t>(*this), &size)) {
+    error::Singleton::instance().throw_with_stack("Failure retrieving the sieve buffer size!");
+  }
+  return size;
+}
+
+void FileAccessList::alignment(hsize_t threshold, hsize_t alignment) const {
+  if (0 > H5Pset_alignment(static_cast<hid_t>(*this), threshold, alignment)) {
+    error::Singleton::instance().throw_with_stack("Failure setting the alignment!");
+  }
+}
+
+hsize_t FileAccessList::alignment() const {
+  hsize_t threshold = 0, alignment = 0;
+  if (0 > H5Pget_alignment(static_cast<hid_t>(*this), &threshold, &alignment)) {
+    error::Singleton::instance().throw_with_stack("Failure retrieving the alignment!");
+  }
+  return alignment;
+}
+
+hsize_t FileAccessList::alignment_threshold() const {
+  hsize_t threshold = 0, alignment = 0;
+  if (0 > H5Pget_alignment(static_cast<hid_t>(*this), &threshold, &alignment)) {
+    error::Singleton::instance().throw_with_stack("Failure retrieving the alignment threshold!");
+  }
+  return threshold;
+}
+
+#if H5_VERSION_GE(1,10,1)
+void FileAccessList::page_buffer_size(size_t size, unsigned min_meta_percent,
+                                      unsigned min_raw_percent) const {
+  if (0 > H5Pset_page_buffer_size(static_cast<hid_t>(*this), size,
+                                  min_meta_percent, min_raw_percent)) {
+    error::Singleton::instance().throw_with_stack("Failure setting the page buffer size!");
+  }
+}
+
+size_t FileAccessList::page_buffer_size() const {
+  size_t size = 0;
+  if (0 > H5Pget_page_buffer_size(static_cast<hid_t>(*this), &size, nullptr, nullptr)) {
+    error::Singleton::instance().throw_with_stack("Failure retrieving the page buffer size!");
+  }
+  return size;
+}
+
+unsigned FileAccessList::page_buffer_min_meta_percent() const {
+  unsigned percent = 0;
+  if (0 > H5Pget_page_buffer_size(static_cast<hid_t>(*this), nullptr, &percent, nullptr)) {
+    error::Singleton::instance().throw_with_stack("Failure retrieving the page buffer metadata share!");
+  }
+  return percent;
+}
+
+unsigned FileAccessList::page_buffer_min_raw_percent() const {
+  unsigned percent = 0;
+  if (0 > H5Pget_page_buffer_size(static_cast<hid_t>(*this), nullptr, nullptr, &percent)) {
+    error::Singleton::instance().throw_with_stack("Failure retrieving the page buffer raw data share!");
+  }
+  return percent;
+}
+
+void FileAccessList::evict_on_close(bool value) const {
+  if (0 > H5Pset_evict_on_close(static_cast<hid_t>(*this), value)) {
+    error::Singleton::instance().throw_with_stack("Failure setting evict on close!");
+  }
+}
+
+bool FileAccessList::evict_on_close() const {
+  hbool_t value = false;
+  if (0 > H5Pget_evict_on_close(static_cast<hid_t>(*this), &value)) {
+    error::Singleton::instance().throw_with_stack("Failure retrieving evict on close!");
+  }
+  return value;
+}
+#endif
+
+void FileAccessList::profile(AccessProfile profile) const {
+  switch (profile) {
+    case AccessProfile::ManySmallObjects: {
+      MetadataCacheConfig config;
+      config.initial_size(16 * 1024 * 1024);
+      config.min_size(4 * 1024 * 1024);
+      config.max_size(64 * 1024 * 1024);
+      metadata_cache_config(config);
+      meta_block_size(64 * 1024);
+      sieve_buffer_size(64 * 1024);
+      break;
+    }
+    case AccessProfile::LargeSequentialDatasets:
+      sieve_buffer_size(4 * 1024 * 1024);
+      alignment(1024 * 1024, 4096);
+#if H5_VERSION_GE(1,10,1)
+      evict_on_close(true);
+#endif
+      break;
+  }
+}
+
 } // namespace property
 } // namespace hdf5
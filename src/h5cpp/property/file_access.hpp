@@ -70,6 +70,104 @@ DLL_EXPORT std::ostream &operator<<(std::ostream &stream, const LibVersion &vers
 
 DLL_EXPORT std::ostream &operator<<(std::ostream &stream, const CloseDegree &version);
 
+//!
+//! \brief preset access profiles
+//!
+//! \sa FileAccessList::profile
+//!
+enum class AccessProfile {
+  //!
+  //! \brief files with many groups, attributes and small datasets
+  //!
+  ManySmallObjects,
+  //!
+  //! \brief files dominated by a few large datasets read sequentially
+  //!
+  LargeSequentialDatasets
+};
+
+DLL_EXPORT std::ostream &operator<<(std::ostream &stream, const AccessProfile &profile);
+
+//!
+//! \brief metadata cache configuration
+//!
+//! Typed access to the most commonly tuned fields of the metadata cache
+//! configuration of libhdf5. All other fields are available via native().
+//!
+//! \sa FileAccessList::metadata_cache_config
+//!
+class DLL_EXPORT MetadataCacheConfig {
+ public:
+  //!
+  //! \brief default constructor
+  //!
+  //! Initializes the configuration with the defaults of the library.
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //!
+  MetadataCacheConfig();
+
+  //!
+  //! \brief constructor
+  //!
+  //! \param config the native configuration
+  //!
+  explicit MetadataCacheConfig(const H5AC_cache_config_t &config) noexcept;
+
+  MetadataCacheConfig(const MetadataCacheConfig &) = default;
+
+  //!
+  //! \brief set the size of the cache when a file is opened
+  //!
+  void initial_size(size_t size) noexcept;
+  size_t initial_size() const noexcept;
+
+  //!
+  //! \brief set the lower bound for the automatic resizing
+  //!
+  void min_size(size_t size) noexcept;
+  size_t min_size() const noexcept;
+
+  //!
+  //! \brief set the upper bound for the automatic resizing
+  //!
+  void max_size(size_t size) noexcept;
+  size_t max_size() const noexcept;
+
+  //!
+  //! \brief enable or disable the automatic resizing
+  //!
+  //! If enabled the cache grows with the hit rate and shrinks entries
+  //! which have not been used for some time. Otherwise its size stays at
+  //! initial_size().
+  //!
+  void adaptive(bool value) noexcept;
+  bool adaptive() const noexcept;
+
+  //!
+  //! \brief set the fraction of the cache kept clean
+  //!
+  void min_clean_fraction(double value) noexcept;
+  double min_clean_fraction() const noexcept;
+
+  //!
+  //! \brief enable or disable evictions
+  //!
+  //! Evictions can only be disabled for a cache which is not adaptive.
+  //!
+  void evictions_enabled(bool value) noexcept;
+  bool evictions_enabled() const noexcept;
+
+  //!
+  //! \brief access the native configuration
+  //!
+  const H5AC_cache_config_t &native() const noexcept;
+  H5AC_cache_config_t &native() noexcept;
+
+ private:
+  H5AC_cache_config_t config_;
+};
+
 //!
 //! \brief file access property list
 //!
@@ -119,6 +217,153 @@ class DLL_EXPORT FileAccessList : public List {
   //! \brief set the file driver
   //!
   void driver(const hdf5::file::Driver &file_driver) const;
+
+  //!
+  //! \brief set the metadata cache configuration
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //! \param config the new configuration
+  //!
+  void metadata_cache_config(const MetadataCacheConfig &config) const;
+
+  //!
+  //! \brief get the metadata cache configuration
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //!
+  MetadataCacheConfig metadata_cache_config() const;
+
+  //!
+  //! \brief set the size of the blocks allocated for metadata
+  //!
+  //! Metadata is aggregated into blocks of at least this size when
+  //! written.
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //! \param size the block size in bytes
+  //!
+  void meta_block_size(hsize_t size) const;
+
+  //!
+  //! \brief get the metadata block size
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //!
+  hsize_t meta_block_size() const;
+
+  //!
+  //! \brief set the size of the raw data sieve buffer
+  //!
+  //! Small raw data accesses to contiguous datasets are served from a
+  //! buffer of this size.
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //! \param size the buffer size in bytes
+  //!
+  void sieve_buffer_size(size_t size) const;
+
+  //!
+  //! \brief get the size of the raw data sieve buffer
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //!
+  size_t sieve_buffer_size() const;
+
+  //!
+  //! \brief set the alignment of file objects
+  //!
+  //! Objects of at least threshold bytes are allocated at multiples of
+  //! alignment.
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //! \param threshold minimum size of aligned objects in bytes
+  //! \param alignment the alignment in bytes
+  //!
+  void alignment(hsize_t threshold, hsize_t alignment) const;
+
+  //!
+  //! \brief get the alignment of file objects
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //!
+  hsize_t alignment() const;
+
+  //!
+  //! \brief get the minimum size of aligned objects
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //!
+  hsize_t alignment_threshold() const;
+
+#if (defined(_DOXYGEN_) || H5_VERSION_GE(1,10,1))
+  //!
+  //! \brief set the page buffer size (*since hdf5 1.10.1*)
+  //!
+  //! The page buffer is only used for files created with the paged file
+  //! space strategy, see FileCreationList::page_size(). Opening other
+  //! files with a page buffer fails.
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //! \param size the buffer size in bytes, 0 disables the buffer
+  //! \param min_meta_percent share of the buffer reserved for metadata
+  //! \param min_raw_percent share of the buffer reserved for raw data
+  //!
+  void page_buffer_size(size_t size, unsigned min_meta_percent = 0,
+                        unsigned min_raw_percent = 0) const;
+
+  //!
+  //! \brief get the page buffer size (*since hdf5 1.10.1*)
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //!
+  size_t page_buffer_size() const;
+
+  //!
+  //! \brief get the share of the page buffer reserved for metadata (*since hdf5 1.10.1*)
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //!
+  unsigned page_buffer_min_meta_percent() const;
+
+  //!
+  //! \brief get the share of the page buffer reserved for raw data (*since hdf5 1.10.1*)
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //!
+  unsigned page_buffer_min_raw_percent() const;
+
+  //!
+  //! \brief evict the metadata of objects when they are closed (*since hdf5 1.10.1*)
+  //!
+  //! Keeps the metadata cache small when many objects are visited once.
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //! \param value true to evict metadata on close
+  //!
+  void evict_on_close(bool value) const;
+
+  //!
+  //! \brief true if metadata is evicted when objects are closed (*since hdf5 1.10.1*)
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //!
+  bool evict_on_close() const;
+#endif
+
+  //!
+  //! \brief apply a preset profile
+  //!
+  //! AccessProfile::ManySmallObjects enlarges the metadata cache to 16 MiB
+  //! (growing up to 64 MiB), uses 64 KiB metadata blocks and a small sieve
+  //! buffer. AccessProfile::LargeSequentialDatasets keeps the metadata
+  //! cache at its default, uses a 4 MiB sieve buffer, aligns objects of
+  //! at least 1 MiB to 4 KiB and evicts metadata on close. All other
+  //! parameters are left unchanged.
+  //!
+  //! \throws std::runtime_error in case of a failure
+  //! \param profile the profile to apply
+  //!
+  void profile(AccessProfile profile) const;
 };
 
 } // namespace property
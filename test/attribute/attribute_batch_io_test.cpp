@@ -0,0 +1,133 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//               2020 Eugen Wintersberger <eugen.wintersberger@gmail.com>
+//
+// This file is part of h5pp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <cstdint>
+#include <h5cpp/hdf5.hpp>
+#include <string>
+#include <vector>
+
+using namespace hdf5;
+using attribute::AttributeMap;
+using attribute::AttributeValue;
+
+SCENARIO("reading all attributes of a node", "[hdf5],[attribute]") {
+  auto f = file::create("attribute_batch_io_test.h5",
+                        file::AccessFlags::Truncate);
+  auto root = f.root();
+
+  root.attributes.create_from<std::int16_t>("signed", -3);
+  root.attributes.create_from<std::uint8_t>("unsigned", 200);
+  root.attributes.create_from<float>("float", 0.5f);
+  root.attributes.create_from<std::string>("NX_class", "NXroot");
+  root.attributes.create_from("shape", std::vector<std::int32_t>{1, 2, 3});
+  root.attributes.create_from("weights", std::vector<double>{0.25, 0.75});
+  root.attributes.create_from("names",
+                              std::vector<std::string>{"x", "y"});
+
+  auto fixed_type = datatype::String::fixed(8);
+  fixed_type.padding(datatype::StringPad::SpacePad);
+  root.attributes.create("units", fixed_type, dataspace::Scalar())
+      .write(std::string("mm"), fixed_type);
+
+  root.attributes.create("empty", datatype::create<int>(),
+                         dataspace::Dataspace(ObjectHandle(H5Screate(H5S_NULL))));
+  root.attributes.create<bool>("flag").write(true);
+  auto state = datatype::Enum::create_underlying(datatype::create<int>());
+  state.insert_underlying("off", 0);
+  state.insert_underlying("on", 1);
+  root.attributes.create("state", state, dataspace::Scalar());
+
+  auto values = root.attributes.read_all();
+
+  THEN("integers, floats and strings are read") {
+    REQUIRE(values.size() == 9ul);
+    REQUIRE(std::get<std::int64_t>(values["signed"]) == -3);
+    REQUIRE(std::get<std::uint64_t>(values["unsigned"]) == 200ul);
+    REQUIRE(std::get<double>(values["float"]) == 0.5);
+    REQUIRE(std::get<std::string>(values["NX_class"]) == "NXroot");
+    REQUIRE(std::get<std::uint64_t>(values["flag"]) == 1ul);
+  }
+  THEN("arrays are read as vectors") {
+    REQUIRE(std::get<std::vector<std::int64_t>>(values["shape"]) ==
+            std::vector<std::int64_t>{1, 2, 3});
+    REQUIRE(std::get<std::vector<double>>(values["weights"]) ==
+            std::vector<double>{0.25, 0.75});
+    REQUIRE(std::get<std::vector<std::string>>(values["names"]) ==
+            std::vector<std::string>{"x", "y"});
+  }
+  THEN("the padding of fixed length strings is removed") {
+    REQUIRE(std::get<std::string>(values["units"]) == "mm");
+  }
+  THEN("attributes of other types and null dataspaces are skipped") {
+    REQUIRE(values.count("empty") == 0ul);
+    REQUIRE(values.count("state") == 0ul);
+  }
+  THEN("a node without attributes gives an empty map") {
+    REQUIRE(root.create_group("group").attributes.read_all().empty());
+  }
+}
+
+SCENARIO("writing a batch of attributes", "[hdf5],[attribute]") {
+  auto f = file::create("attribute_batch_write_test.h5",
+                        file::AccessFlags::Truncate);
+  auto group = f.root().create_group("entry");
+  group.attributes.create_from<std::string>("NX_class", "NXdata");
+
+  AttributeMap values{
+      {"NX_class", std::string("NXentry")},
+      {"count", std::int64_t(-7)},
+      {"size", std::uint64_t(42)},
+      {"scale", 1.5},
+      {"axes", std::vector<std::string>{"x", "y"}},
+      {"offsets", std::vector<std::int64_t>{4, 5}},
+      {"ids", std::vector<std::uint64_t>{7}},
+      {"range", std::vector<double>{0.0, 10.0}}};
+  group.attributes.write_batch(values);
+
+  THEN("the attributes can be read with the regular interface") {
+    std::string nx_class;
+    group.attributes["NX_class"].read(nx_class);
+    REQUIRE(nx_class == "NXentry");
+    std::int64_t count = 0;
+    group.attributes["count"].read(count);
+    REQUIRE(count == -7);
+    double scale = 0.0;
+    group.attributes["scale"].read(scale);
+    REQUIRE(scale == 1.5);
+    std::vector<std::string> axes(2);
+    group.attributes["axes"].read(axes);
+    REQUIRE(axes == std::vector<std::string>{"x", "y"});
+  }
+  THEN("existing attributes are replaced") {
+    REQUIRE(group.attributes.size() == values.size());
+  }
+  THEN("reading all attributes gives the map back") {
+    REQUIRE(group.attributes.read_all() == values);
+  }
+}
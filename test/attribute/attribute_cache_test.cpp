@@ -0,0 +1,195 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//               2020 Eugen Wintersberger <eugen.wintersberger@gmail.com>
+//
+// This file is part of h5pp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <cstdint>
+#include <h5cpp/hdf5.hpp>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace hdf5;
+using attribute::AttributeCache;
+
+SCENARIO("reading single attribute values", "[hdf5],[attribute]") {
+  auto f = file::create("attribute_cache_value_test.h5",
+                        file::AccessFlags::Truncate);
+  auto root = f.root();
+  root.attributes.create_from<std::int32_t>("count", 5);
+  root.attributes.create_from<std::string>("units", "mm");
+  root.attributes.create_from("shape", std::vector<std::uint16_t>{2, 3});
+
+  GIVEN("no cache enabled for the file") {
+    AttributeCache::instance().clear();
+    THEN("the attributes are read directly") {
+      REQUIRE(std::get<std::int64_t>(root.attributes.value("count")) == 5);
+      REQUIRE(std::get<std::string>(root.attributes.value("units")) == "mm");
+      REQUIRE(std::get<std::vector<std::uint64_t>>(
+                  root.attributes.value("shape")) ==
+              std::vector<std::uint64_t>{2, 3});
+      REQUIRE(AttributeCache::instance().misses() == 0);
+      REQUIRE(AttributeCache::instance().size() == 0);
+    }
+    THEN("a missing attribute raises an exception") {
+      REQUIRE_THROWS_AS(root.attributes.value("missing"), std::runtime_error);
+    }
+    THEN("requesting the values of the cache fails") {
+      REQUIRE_THROWS_AS(AttributeCache::instance().values(root),
+                        std::runtime_error);
+    }
+  }
+}
+
+SCENARIO("caching attribute values", "[hdf5],[attribute]") {
+  auto f = file::create("attribute_cache_test.h5",
+                        file::AccessFlags::Truncate);
+  auto root = f.root();
+  auto group = root.create_group("entry");
+  group.attributes.create_from<std::int32_t>("count", 5);
+  group.attributes.create_from<std::string>("units", "mm");
+  node::link(group, root, "alias");
+
+  auto &cache = AttributeCache::instance();
+  cache.clear();
+  cache.enable(f);
+
+  GIVEN("a first access to an attribute") {
+    REQUIRE(std::get<std::int64_t>(group.attributes.value("count")) == 5);
+    THEN("all attributes of the node are read") {
+      REQUIRE(cache.misses() == 1);
+      REQUIRE(cache.hits() == 0);
+      REQUIRE(cache.size() == 1);
+    }
+    AND_WHEN("accessing another attribute of the node") {
+      REQUIRE(std::get<std::string>(group.attributes.value("units")) == "mm");
+      THEN("the value is taken from the cache") {
+        REQUIRE(cache.misses() == 1);
+        REQUIRE(cache.hits() == 1);
+      }
+    }
+    AND_WHEN("accessing the node via a different link") {
+      node::Group alias = root["alias"];
+      REQUIRE(std::get<std::int64_t>(alias.attributes.value("count")) == 5);
+      THEN("the entry of the object is used") {
+        REQUIRE(cache.hits() == 1);
+        REQUIRE(cache.size() == 1);
+      }
+    }
+    AND_WHEN("writing to the attribute") {
+      group.attributes["count"].write(std::int32_t(7));
+      THEN("the new value is read") {
+        REQUIRE(cache.size() == 0);
+        REQUIRE(std::get<std::int64_t>(group.attributes.value("count")) == 7);
+        REQUIRE(cache.misses() == 2);
+      }
+    }
+    AND_WHEN("creating a new attribute") {
+      group.attributes.create_from<double>("scale", 0.5);
+      THEN("the new attribute is found") {
+        REQUIRE(std::get<double>(group.attributes.value("scale")) == 0.5);
+      }
+    }
+    AND_WHEN("renaming an attribute") {
+      group.attributes.rename("units", "unit");
+      THEN("only the new name is found") {
+        REQUIRE(std::get<std::string>(group.attributes.value("unit")) == "mm");
+        REQUIRE_THROWS_AS(group.attributes.value("units"), std::runtime_error);
+      }
+    }
+    AND_WHEN("removing an attribute") {
+      group.attributes.remove("count");
+      THEN("the attribute is no longer found") {
+        REQUIRE_THROWS_AS(group.attributes.value("count"), std::runtime_error);
+      }
+    }
+    AND_WHEN("writing a batch of attributes") {
+      group.attributes.write_batch({{"count", std::int64_t(9)}});
+      THEN("the new values are read") {
+        REQUIRE(std::get<std::int64_t>(group.attributes.value("count")) == 9);
+      }
+    }
+    AND_WHEN("disabling the cache") {
+      cache.disable(f);
+      THEN("all entries are dropped") {
+        REQUIRE_FALSE(cache.is_enabled(f));
+        REQUIRE_FALSE(cache.is_active());
+        REQUIRE(cache.size() == 0);
+        REQUIRE(std::get<std::int64_t>(group.attributes.value("count")) == 5);
+      }
+    }
+  }
+  cache.clear();
+}
+
+SCENARIO("warming the attribute cache", "[hdf5],[attribute]") {
+  auto f = file::create("attribute_cache_warm_test.h5",
+                        file::AccessFlags::Truncate);
+  auto root = f.root();
+  root.attributes.create_from<std::string>("NX_class", "NXroot");
+  for (int index = 0; index < 10; ++index) {
+    auto group = root.create_group("entry_" + std::to_string(index));
+    group.attributes.create_from<std::int32_t>("index", index);
+    node::Dataset dataset(group, "data", datatype::create<double>(),
+                          dataspace::Simple({3}));
+    dataset.attributes.create_from<std::string>("units", "mm");
+  }
+  root.create_group("plain");
+
+  auto &cache = AttributeCache::instance();
+  cache.clear();
+
+  GIVEN("a file without an enabled cache") {
+    THEN("warming fails") {
+      REQUIRE_THROWS_AS(cache.warm(root), std::runtime_error);
+    }
+  }
+
+  GIVEN("a file with an enabled cache") {
+    cache.enable(f);
+    cache.warm(root);
+    THEN("all objects with attributes are cached") {
+      REQUIRE(cache.size() == 21);
+      REQUIRE(cache.misses() == 21);
+    }
+    AND_THEN("all further accesses are hits") {
+      REQUIRE(std::get<std::string>(root.attributes.value("NX_class")) ==
+              "NXroot");
+      node::Group group = root["entry_3"];
+      REQUIRE(std::get<std::int64_t>(group.attributes.value("index")) == 3);
+      node::Dataset dataset = group["data"];
+      REQUIRE(std::get<std::string>(dataset.attributes.value("units")) == "mm");
+      REQUIRE(cache.hits() == 3);
+      REQUIRE(cache.misses() == 21);
+    }
+    AND_THEN("warming again reads nothing") {
+      cache.warm(root);
+      REQUIRE(cache.misses() == 21);
+    }
+  }
+  cache.clear();
+}
@@ -0,0 +1,160 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace hdf5;
+using concurrency::ExecutionMode;
+using concurrency::Executor;
+
+namespace {
+
+void write_concurrently(const node::Group& base, size_t threads,
+                        size_t datasets) {
+  auto& executor = Executor::instance();
+  std::vector<std::thread> workers;
+  for (size_t thread = 0; thread < threads; ++thread)
+    workers.emplace_back([&, thread]() {
+      for (size_t index = 0; index < datasets; ++index) {
+        // prepared outside the executor in parallel
+        std::vector<int> data(100, static_cast<int>(thread * datasets + index));
+        std::string name = "data_" + std::to_string(thread) + "_" +
+                           std::to_string(index);
+        executor.run([&]() {
+          node::Dataset dataset(base, name, datatype::create<int>(),
+                                dataspace::Simple{{100}});
+          dataset.write(data);
+        });
+      }
+    });
+  for (auto& worker : workers) worker.join();
+}
+
+void check_written(const node::Group& base, size_t threads, size_t datasets) {
+  std::vector<int> data(100);
+  for (size_t thread = 0; thread < threads; ++thread)
+    for (size_t index = 0; index < datasets; ++index) {
+      node::Dataset dataset = base.nodes["data_" + std::to_string(thread) + "_" +
+                                        std::to_string(index)];
+      dataset.read(data);
+      REQUIRE(data.front() == static_cast<int>(thread * datasets + index));
+    }
+}
+
+}  // namespace
+
+SCENARIO("serializing HDF5 calls with the global mutex") {
+  auto& executor = Executor::instance();
+  REQUIRE(executor.mode() == ExecutionMode::GlobalMutex);
+
+  THEN("calls are executed on the calling thread") {
+    auto id = executor.run([]() { return std::this_thread::get_id(); });
+    REQUIRE(id == std::this_thread::get_id());
+  }
+  THEN("calls can be nested") {
+    REQUIRE_FALSE(executor.is_executing());
+    int result = executor.run([&executor]() {
+      REQUIRE(executor.is_executing());
+      return executor.run([]() { return 42; });
+    });
+    REQUIRE(result == 42);
+    REQUIRE_FALSE(executor.is_executing());
+  }
+  THEN("exceptions are passed to the caller") {
+    REQUIRE_THROWS_AS(executor.run([]() { throw std::runtime_error("failure"); }),
+                      std::runtime_error);
+    REQUIRE_FALSE(executor.is_executing());
+  }
+  THEN("the mode cannot be changed from within a call") {
+    REQUIRE_THROWS_AS(
+        executor.run([&executor]() { executor.mode(ExecutionMode::SerializedWorker); }),
+        std::logic_error);
+  }
+  GIVEN("several threads writing to a file") {
+    auto f = file::create("executor_mutex_test.h5", file::AccessFlags::Truncate);
+    write_concurrently(f.root(), 4, 25);
+    THEN("all data has been written") { check_written(f.root(), 4, 25); }
+  }
+}
+
+SCENARIO("serializing HDF5 calls on a worker thread") {
+  auto& executor = Executor::instance();
+  executor.mode(ExecutionMode::SerializedWorker);
+  REQUIRE(executor.mode() == ExecutionMode::SerializedWorker);
+
+  THEN("calls are executed on the worker thread") {
+    auto id = executor.run([]() { return std::this_thread::get_id(); });
+    REQUIRE(id != std::this_thread::get_id());
+    AND_THEN("nested calls stay on the worker") {
+      auto ids = executor.run([&executor]() {
+        return std::make_pair(std::this_thread::get_id(),
+                              executor.run([]() { return std::this_thread::get_id(); }));
+      });
+      REQUIRE(ids.first == ids.second);
+    }
+  }
+  THEN("exceptions are passed to the caller") {
+    REQUIRE_THROWS_AS(executor.run([]() { throw std::runtime_error("failure"); }),
+                      std::runtime_error);
+  }
+  GIVEN("several threads writing to a file") {
+    auto f = file::create("executor_worker_test.h5", file::AccessFlags::Truncate);
+    write_concurrently(f.root(), 4, 25);
+    THEN("all data has been written") { check_written(f.root(), 4, 25); }
+  }
+
+  executor.mode(ExecutionMode::GlobalMutex);
+  REQUIRE(executor.mode() == ExecutionMode::GlobalMutex);
+}
+
+SCENARIO("changing the execution mode while calls are executed") {
+  auto& executor = Executor::instance();
+  auto f = file::create("executor_mode_test.h5", file::AccessFlags::Truncate);
+  auto root = f.root();
+
+  std::atomic<bool> running{true};
+  std::thread switcher([&]() {
+    while (running) {
+      executor.mode(ExecutionMode::SerializedWorker);
+      executor.mode(ExecutionMode::GlobalMutex);
+    }
+  });
+  write_concurrently(root, 4, 25);
+  running = false;
+  switcher.join();
+
+  THEN("all calls have been executed") {
+    REQUIRE(executor.mode() == ExecutionMode::GlobalMutex);
+    check_written(root, 4, 25);
+  }
+}
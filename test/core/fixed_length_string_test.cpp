@@ -0,0 +1,162 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/core/fixed_length_string.hpp>
+#include <string>
+#include <vector>
+
+using namespace hdf5;
+using datatype::StringPad;
+
+SCENARIO("trimming fixed length strings") {
+  GIVEN("null terminated and null padded strings") {
+    const char data[] = {'h', 'e', 'l', 'l', 'o', '\0', '\0', '\0'};
+    THEN("the padding starts at the first null character") {
+      REQUIRE(fixed_length_string_size(data, 8, StringPad::NullTerm) == 5ul);
+      REQUIRE(fixed_length_string_size(data, 8, StringPad::NullPad) == 5ul);
+      REQUIRE(fixed_length_string_size(data, 5, StringPad::NullPad) == 5ul);
+    }
+  }
+  GIVEN("space padded strings") {
+    std::string data = "hello" + std::string(20, ' ');
+    THEN("trailing spaces are removed") {
+      REQUIRE(fixed_length_string_size(data.data(), data.size(), StringPad::SpacePad) == 5ul);
+      REQUIRE(fixed_length_string_size(data.data(), 3, StringPad::SpacePad) == 3ul);
+      REQUIRE(fixed_length_string_size(" a b    ", 8, StringPad::SpacePad) == 4ul);
+      REQUIRE(fixed_length_string_size("          ", 10, StringPad::SpacePad) == 0ul);
+    }
+  }
+}
+
+SCENARIO("packing and unpacking fixed length strings") {
+  std::vector<std::string> strings{"hello", "", "a longer string", "world"};
+  const size_t size = 8;
+  std::vector<char> buffer(strings.size() * size, 'x');
+
+  GIVEN("a null padded type") {
+    pack_fixed_length_strings(strings.data(), strings.size(), size,
+                              StringPad::NullPad, buffer.data());
+    THEN("strings are truncated and padded with null characters") {
+      REQUIRE(std::string(buffer.data(), size) == std::string("hello\0\0\0", size));
+      REQUIRE(std::string(buffer.data() + size, size) == std::string(size, '\0'));
+      REQUIRE(std::string(buffer.data() + 2 * size, size) == "a longer");
+    }
+    AND_THEN("unpacking with trimming restores the strings") {
+      std::vector<std::string> read(strings.size());
+      unpack_fixed_length_strings(buffer.data(), read.size(), size,
+                                  StringPad::NullPad, true, read.data());
+      REQUIRE(read == std::vector<std::string>{"hello", "", "a longer", "world"});
+    }
+    AND_THEN("unpacking without trimming keeps the padding") {
+      std::vector<std::string> read(strings.size());
+      unpack_fixed_length_strings(buffer.data(), read.size(), size,
+                                  StringPad::NullPad, false, read.data());
+      for (const auto& str : read) REQUIRE(str.size() == size);
+    }
+  }
+
+  GIVEN("a space padded type") {
+    pack_fixed_length_strings(strings.data(), strings.size(), size,
+                              StringPad::SpacePad, buffer.data());
+    THEN("strings are padded with spaces") {
+      REQUIRE(std::string(buffer.data(), size) == "hello   ");
+      REQUIRE(std::string(buffer.data() + size, size) == "        ");
+    }
+    AND_THEN("unpacking with trimming restores the strings") {
+      std::vector<std::string> read(strings.size());
+      unpack_fixed_length_strings(buffer.data(), read.size(), size,
+                                  StringPad::SpacePad, true, read.data());
+      REQUIRE(read == std::vector<std::string>{"hello", "", "a longer", "world"});
+    }
+  }
+}
+
+namespace {
+
+// the character loops used before memcpy/memchr based packing
+std::vector<char> pack_loop(const std::vector<std::string>& data, size_t size) {
+  std::vector<char> buffer(data.size() * size);
+  auto iter = buffer.begin();
+  for (const auto& str : data) {
+    std::copy(str.begin(), str.end(), iter);
+    std::advance(iter, static_cast<std::ptrdiff_t>(size));
+  }
+  return buffer;
+}
+
+std::vector<std::string> unpack_loop(const std::vector<char>& buffer, size_t size) {
+  std::vector<std::string> data;
+  auto start = buffer.begin();
+  while (start != buffer.end()) {
+    auto end = start + static_cast<std::ptrdiff_t>(size);
+    data.push_back(std::string(start, end));
+    start = end;
+  }
+  return data;
+}
+
+}  // namespace
+
+SCENARIO("fixed length string packing performance") {
+  const size_t count = 100000;
+  const size_t size = 64;
+  std::vector<std::string> strings(count);
+  for (size_t index = 0; index < count; ++index)
+    strings[index] = "message number " + std::to_string(index);
+  std::vector<char> buffer(count * size);
+  std::vector<std::string> read(count);
+
+  BENCHMARK("packing 100000 strings with character loops") {
+    return pack_loop(strings, size).size();
+  };
+
+  BENCHMARK("packing 100000 strings with memcpy") {
+    pack_fixed_length_strings(strings.data(), count, size, StringPad::NullPad,
+                              buffer.data());
+    return buffer.size();
+  };
+
+  pack_fixed_length_strings(strings.data(), count, size, StringPad::NullPad,
+                            buffer.data());
+
+  BENCHMARK("unpacking 100000 strings with character loops") {
+    return unpack_loop(buffer, size).size();
+  };
+
+  BENCHMARK("unpacking 100000 strings into existing strings") {
+    unpack_fixed_length_strings(buffer.data(), count, size, StringPad::NullPad,
+                                false, read.data());
+    return read.size();
+  };
+
+  BENCHMARK("unpacking and trimming 100000 strings") {
+    unpack_fixed_length_strings(buffer.data(), count, size, StringPad::NullPad,
+                                true, read.data());
+    return read.size();
+  };
+}
@@ -0,0 +1,74 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/core/string_arena.hpp>
+#include <cstdint>
+#include <cstring>
+
+using namespace hdf5;
+
+SCENARIO("allocating memory from a string arena") {
+  StringArena arena(64);
+  REQUIRE(arena.size() == 0ul);
+  REQUIRE(arena.capacity() == 0ul);
+
+  GIVEN("several allocations") {
+    std::vector<char*> pointers;
+    for (size_t index = 0; index < 100; ++index) {
+      auto memory = static_cast<char*>(arena.allocate(index + 1));
+      std::memset(memory, static_cast<int>(index), index + 1);
+      pointers.push_back(memory);
+    }
+    THEN("the memory is aligned and not overlapping") {
+      for (size_t index = 0; index < pointers.size(); ++index) {
+        REQUIRE(reinterpret_cast<std::uintptr_t>(pointers[index]) %
+                    alignof(std::max_align_t) == 0);
+        for (size_t pos = 0; pos <= index; ++pos)
+          REQUIRE(pointers[index][pos] == static_cast<char>(index));
+      }
+      REQUIRE(arena.size() >= 5050ul);
+      REQUIRE(arena.capacity() >= arena.size());
+    }
+    AND_WHEN("clearing the arena") {
+      size_t capacity = arena.capacity();
+      arena.clear();
+      THEN("the largest block is kept") {
+        REQUIRE(arena.size() == 0ul);
+        REQUIRE(arena.capacity() > 0ul);
+        REQUIRE(arena.capacity() < capacity);
+      }
+    }
+  }
+
+  GIVEN("an allocation larger than the block size") {
+    arena.allocate(1000);
+    THEN("a block of sufficient size is allocated") {
+      REQUIRE(arena.capacity() >= 1000ul);
+    }
+  }
+}
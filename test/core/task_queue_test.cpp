@@ -0,0 +1,91 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/core/task_queue.hpp>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace hdf5;
+
+SCENARIO("executing tasks on a task queue") {
+  TaskQueue queue;
+
+  GIVEN("a sequence of tasks") {
+    std::vector<int> order;
+    std::vector<std::future<int>> results;
+    for (int index = 0; index < 100; ++index)
+      results.push_back(queue.submit([&order, index]() {
+        order.push_back(index);
+        return index;
+      }));
+
+    THEN("the tasks are executed in the order of submission") {
+      for (int index = 0; index < 100; ++index)
+        REQUIRE(results[static_cast<size_t>(index)].get() == index);
+      queue.wait();
+      REQUIRE(queue.pending() == 0ul);
+      REQUIRE(order.size() == 100ul);
+      for (size_t index = 0; index < order.size(); ++index)
+        REQUIRE(order[index] == static_cast<int>(index));
+    }
+  }
+
+  GIVEN("a task running on the worker") {
+    auto on_worker = queue.submit([&queue]() { return queue.is_worker_thread(); });
+    THEN("it is not running on the calling thread") {
+      REQUIRE(on_worker.get());
+      REQUIRE_FALSE(queue.is_worker_thread());
+    }
+  }
+
+  GIVEN("a failing task") {
+    auto failed = queue.submit([]() { throw std::runtime_error("failure"); });
+    auto next = queue.submit([]() { return 42; });
+    THEN("the exception is delivered via the future") {
+      REQUIRE_THROWS_AS(failed.get(), std::runtime_error);
+      AND_THEN("the queue continues with the next task") {
+        REQUIRE(next.get() == 42);
+      }
+    }
+  }
+}
+
+SCENARIO("destroying a task queue with pending tasks") {
+  int counter = 0;
+  {
+    TaskQueue queue;
+    for (int index = 0; index < 10; ++index)
+      queue.submit([&counter]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ++counter;
+      });
+  }
+  REQUIRE(counter == 10);
+}
@@ -0,0 +1,117 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <cstdint>
+#include <h5cpp/hdf5.hpp>
+
+namespace reflection {
+
+struct Event {
+  double energy;
+  std::uint64_t timestamp;
+  std::uint16_t detector;
+};
+
+struct Point {
+  std::int32_t x;
+  std::int32_t y;
+  std::int32_t z;
+};
+
+}  // namespace reflection
+
+H5CPP_COMPOUND(reflection::Event, energy, timestamp, detector)
+H5CPP_COMPOUND(reflection::Point, x, y, z)
+
+using namespace hdf5;
+using namespace hdf5::datatype;
+
+static_assert(!TypeTrait<reflection::Event>::packed, "Event has tail padding");
+static_assert(TypeTrait<reflection::Point>::packed, "Point has no padding");
+
+SCENARIO("creating compound types from a field list") {
+  GIVEN("the type of a reflected structure") {
+    auto type = datatype::create<reflection::Event>();
+    THEN("it has the size of the structure") {
+      REQUIRE(type.size() == sizeof(reflection::Event));
+    }
+    THEN("it has a field for every member") {
+      REQUIRE(type.number_of_fields() == 3ul);
+      REQUIRE(type.field_name(0) == "energy");
+      REQUIRE(type.field_name(1) == "timestamp");
+      REQUIRE(type.field_name(2) == "detector");
+    }
+    THEN("the fields have the offsets of the members") {
+      REQUIRE(type.field_offset("energy") == offsetof(reflection::Event, energy));
+      REQUIRE(type.field_offset("timestamp") ==
+              offsetof(reflection::Event, timestamp));
+      REQUIRE(type.field_offset("detector") ==
+              offsetof(reflection::Event, detector));
+    }
+    THEN("the fields have the types of the members") {
+      REQUIRE(type["energy"] == datatype::create<double>());
+      REQUIRE(type["timestamp"] == datatype::create<std::uint64_t>());
+      REQUIRE(type["detector"] == datatype::create<std::uint16_t>());
+    }
+    THEN("the static instance is equal to a new one") {
+      REQUIRE(datatype::get<reflection::Event>() == type);
+    }
+  }
+}
+
+SCENARIO("comparing the layout of compound types") {
+  auto type = datatype::create<reflection::Point>();
+  GIVEN("a type with the same layout but other field names") {
+    auto other = Compound::create(sizeof(reflection::Point));
+    other.insert("h", 0, datatype::create<std::int32_t>());
+    other.insert("k", 4, datatype::create<std::int32_t>());
+    other.insert("l", 8, datatype::create<std::int32_t>());
+    THEN("the layouts are identical") {
+      REQUIRE(type.is_layout_identical(other));
+      REQUIRE(other.is_layout_identical(type));
+    }
+  }
+  GIVEN("a type with a different field type") {
+    auto other = Compound::create(sizeof(reflection::Point));
+    other.insert("x", 0, datatype::create<std::int32_t>());
+    other.insert("y", 4, datatype::create<std::uint32_t>());
+    other.insert("z", 8, datatype::create<std::int32_t>());
+    THEN("the layouts differ") { REQUIRE_FALSE(type.is_layout_identical(other)); }
+  }
+  GIVEN("a type with fewer fields") {
+    auto other = Compound::create(sizeof(reflection::Point));
+    other.insert("x", 0, datatype::create<std::int32_t>());
+    THEN("the layouts differ") { REQUIRE_FALSE(type.is_layout_identical(other)); }
+  }
+  GIVEN("a type which is not a compound") {
+    THEN("the layouts differ") {
+      REQUIRE_FALSE(type.is_layout_identical(datatype::create<std::int32_t>()));
+    }
+  }
+}
@@ -0,0 +1,105 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <thread>
+#include <vector>
+#include <h5cpp/hdf5.hpp>
+
+using namespace hdf5;
+using namespace hdf5::datatype;
+
+SCENARIO("caching datatypes") {
+  auto& cache = TypeCache::instance();
+  cache.clear();
+
+  GIVEN("a type for a C++ type") {
+    const Datatype& type = cache.get<double>();
+    THEN("the type was created once") {
+      REQUIRE(type == datatype::create<double>());
+      REQUIRE(cache.misses() == 1ul);
+      REQUIRE(cache.hits() == 0ul);
+      REQUIRE(cache.size() == 1ul);
+    }
+    AND_THEN("further lookups return the same instance") {
+      REQUIRE(&cache.get<double>() == &type);
+      REQUIRE(&cache.get<double>() == &type);
+      REQUIRE(cache.hits() == 2ul);
+      REQUIRE(cache.misses() == 1ul);
+    }
+    AND_THEN("other C++ types get their own entry") {
+      REQUIRE(cache.get<int>() == datatype::create<int>());
+      REQUIRE(cache.size() == 2ul);
+    }
+  }
+
+  GIVEN("string types") {
+    const String& variable = cache.variable_string(CharacterEncoding::UTF8);
+    const String& fixed = cache.fixed_string(10, CharacterEncoding::ASCII,
+                                             StringPad::SpacePad);
+    THEN("the types have the requested properties") {
+      REQUIRE(variable.is_variable_length());
+      REQUIRE(variable.encoding() == CharacterEncoding::UTF8);
+      REQUIRE_FALSE(fixed.is_variable_length());
+      REQUIRE(fixed.size() == 10ul);
+      REQUIRE(fixed.padding() == StringPad::SpacePad);
+    }
+    THEN("every size, encoding and padding has its own entry") {
+      REQUIRE(&cache.fixed_string(10, CharacterEncoding::ASCII,
+                                  StringPad::SpacePad) == &fixed);
+      REQUIRE(&cache.fixed_string(10, CharacterEncoding::ASCII,
+                                  StringPad::NullPad) != &fixed);
+      REQUIRE(&cache.fixed_string(11, CharacterEncoding::ASCII,
+                                  StringPad::SpacePad) != &fixed);
+      REQUIRE(&cache.variable_string(CharacterEncoding::ASCII) != &variable);
+      REQUIRE(cache.size() == 5ul);
+    }
+    THEN("a fixed string of size 0 fails") {
+      REQUIRE_THROWS_AS(cache.fixed_string(0), std::runtime_error);
+      REQUIRE(cache.size() == 2ul);
+    }
+  }
+
+  GIVEN("several threads using the same key") {
+    std::vector<const Datatype*> types(8);
+    std::vector<std::thread> threads;
+    for (size_t index = 0; index < types.size(); ++index)
+      threads.emplace_back([&types, &cache, index]() {
+        for (size_t count = 0; count < 100; ++count)
+          types[index] = &cache.get<float>();
+      });
+    for (auto& thread : threads) thread.join();
+    THEN("all threads got the same instance") {
+      for (const auto* type : types) REQUIRE(type == types.front());
+      REQUIRE(cache.hits() + cache.misses() == 800ul);
+      REQUIRE(cache.size() == 1ul);
+    }
+  }
+
+  cache.clear();
+}
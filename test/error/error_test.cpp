@@ -154,3 +154,32 @@ TEST_CASE_METHOD(ErrorTestCase, "testing exception generation printing off", "[h
 #endif
   }
 }
+
+TEST_CASE_METHOD(ErrorTestCase, "testing lazy stack decoding", "[h5cpp][error]") {
+  auto &singleton = error::Singleton::instance();
+  std::string eager;
+  try {
+    provoke_h5cpp_exception();
+  } catch (std::exception& e) {
+    eager = error::print_nested(e);
+  }
+
+  singleton.lazy_stack(true);
+  REQUIRE(singleton.lazy_stack());
+  try {
+    provoke_h5cpp_exception();
+  } catch (std::exception& e) {
+    REQUIRE(error::print_nested(e) == eager);
+    try {
+      std::rethrow_if_nested(e);
+    } catch (const error::H5CError& stack) {
+      REQUIRE(stack.contents().size() == 2ul);
+      error::H5CError copy = stack;
+      REQUIRE(std::string(copy.what()) == stack.what());
+    }
+  }
+  REQUIRE(singleton.extract_stack().empty());
+
+  singleton.lazy_stack(false);
+  REQUIRE_FALSE(singleton.lazy_stack());
+}
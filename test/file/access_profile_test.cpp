@@ -0,0 +1,184 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//               2020 Eugen Wintersberger <eugen.wintersberger@gmail.com>
+//
+// This file is part of h5pp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+#include <string>
+#include <vector>
+
+using namespace hdf5;
+
+namespace {
+
+//
+// NeXus like file with many small groups and one large detector dataset
+//
+void create_nexus_file(const std::string &name,
+                       const property::FileCreationList &fcpl,
+                       size_t modules, size_t frames) {
+  auto f = file::create(name, file::AccessFlags::Truncate, fcpl);
+  auto entry = f.root().create_group("entry");
+  entry.attributes.create_from<std::string>("NX_class", "NXentry");
+  auto instrument = entry.create_group("instrument");
+  instrument.attributes.create_from<std::string>("NX_class", "NXinstrument");
+  for (size_t index = 0; index < modules; ++index) {
+    auto module = instrument.create_group("module_" + std::to_string(index));
+    module.attributes.create_from<std::string>("NX_class", "NXdetector_module");
+    module.attributes.create_from<std::string>("depends_on", ".");
+    for (const auto &field : {"x_pixel_size", "y_pixel_size", "distance"}) {
+      node::Dataset d(module, field, datatype::create<double>(),
+                      dataspace::Scalar());
+      d.write(0.075 * static_cast<double>(index));
+      d.attributes.create_from<std::string>("units", "mm");
+    }
+  }
+
+  std::vector<std::uint16_t> frame(512 * 512, 7);
+  node::Dataset data(entry, "data", datatype::create<std::uint16_t>(),
+                     dataspace::Simple({frames, 512, 512}));
+  for (size_t index = 0; index < frames; ++index)
+    data.write(frame, dataspace::Hyperslab{{index, 0, 0}, {1, 512, 512}});
+}
+
+size_t visit_metadata(const std::string &name,
+                      const property::FileAccessList &fapl) {
+  auto f = file::open(name, file::AccessFlags::ReadOnly, fapl);
+  node::Group instrument = f.root()["entry/instrument"];
+  size_t count = 0;
+  for (auto module : instrument.nodes) {
+    count += module.attributes.size();
+    for (auto field : node::Group(module).nodes) {
+      double value = 0.0;
+      node::Dataset(field).read(value);
+      count += field.attributes.size();
+    }
+  }
+  return count;
+}
+
+std::uint64_t read_rows(const std::string &name,
+                        const property::FileAccessList &fapl) {
+  auto f = file::open(name, file::AccessFlags::ReadOnly, fapl);
+  node::Dataset data = f.root()["entry/data"];
+  auto frames = dataspace::Simple(data.dataspace()).current_dimensions()[0];
+  std::vector<std::uint16_t> row(512);
+  std::uint64_t sum = 0;
+  for (hsize_t frame = 0; frame < frames; ++frame)
+    for (hsize_t y = 0; y < 512; y += 4) {
+      data.read(row, dataspace::Hyperslab{{frame, y, 0}, {1, 1, 512}});
+      sum += row.front();
+    }
+  return sum;
+}
+
+}  // namespace
+
+SCENARIO("opening files with tuned access property lists") {
+  property::FileCreationList fcpl;
+  create_nexus_file("access_profile_test.h5", fcpl, 10, 2);
+
+  GIVEN("the profile for many small objects") {
+    property::FileAccessList fapl;
+    fapl.profile(property::AccessProfile::ManySmallObjects);
+    THEN("the metadata can be read") {
+      REQUIRE(visit_metadata("access_profile_test.h5", fapl) == 50);
+    }
+  }
+
+  GIVEN("the profile for large sequential datasets") {
+    property::FileAccessList fapl;
+    fapl.profile(property::AccessProfile::LargeSequentialDatasets);
+    THEN("the data can be read") {
+      REQUIRE(read_rows("access_profile_test.h5", fapl) == 2 * 128 * 7);
+      REQUIRE(visit_metadata("access_profile_test.h5", fapl) == 50);
+    }
+  }
+
+#if H5_VERSION_GE(1,10,1)
+  GIVEN("a page buffer") {
+    property::FileAccessList fapl;
+    fapl.page_buffer_size(64 * 4096);
+    THEN("a file without paged allocation cannot be opened") {
+      REQUIRE_THROWS_AS(file::open("access_profile_test.h5",
+                                   file::AccessFlags::ReadOnly, fapl),
+                        std::runtime_error);
+    }
+    AND_GIVEN("a file with paged allocation") {
+      property::FileCreationList paged;
+      H5Pset_file_space_strategy(static_cast<hid_t>(paged), H5F_FSPACE_STRATEGY_PAGE,
+                                 0, 1);
+      paged.page_size(4096);
+      create_nexus_file("access_profile_paged_test.h5", paged, 10, 2);
+      THEN("the file can be read through the page buffer") {
+        REQUIRE(visit_metadata("access_profile_paged_test.h5", fapl) == 50);
+        REQUIRE(read_rows("access_profile_paged_test.h5", fapl) == 2 * 128 * 7);
+      }
+    }
+  }
+#endif
+}
+
+SCENARIO("reading a large NeXus file with access profiles", "[benchmark]") {
+  property::FileCreationList fcpl;
+  create_nexus_file("access_profile_benchmark.h5", fcpl, 300, 16);
+  property::FileAccessList defaults;
+  property::FileAccessList small_objects;
+  small_objects.profile(property::AccessProfile::ManySmallObjects);
+  property::FileAccessList sequential;
+  sequential.profile(property::AccessProfile::LargeSequentialDatasets);
+
+  BENCHMARK("metadata with default settings") {
+    return visit_metadata("access_profile_benchmark.h5", defaults);
+  };
+  BENCHMARK("metadata with the small objects profile") {
+    return visit_metadata("access_profile_benchmark.h5", small_objects);
+  };
+  BENCHMARK("rows with default settings") {
+    return read_rows("access_profile_benchmark.h5", defaults);
+  };
+  BENCHMARK("rows with the sequential profile") {
+    return read_rows("access_profile_benchmark.h5", sequential);
+  };
+
+#if H5_VERSION_GE(1,10,1)
+  property::FileCreationList paged;
+  H5Pset_file_space_strategy(static_cast<hid_t>(paged), H5F_FSPACE_STRATEGY_PAGE,
+                             0, 1);
+  paged.page_size(64 * 1024);
+  create_nexus_file("access_profile_paged_benchmark.h5", paged, 300, 16);
+  property::FileAccessList page_buffer;
+  page_buffer.page_buffer_size(16 * 1024 * 1024);
+
+  BENCHMARK("paged file metadata without page buffer") {
+    return visit_metadata("access_profile_paged_benchmark.h5", defaults);
+  };
+  BENCHMARK("paged file metadata with page buffer") {
+    return visit_metadata("access_profile_paged_benchmark.h5", page_buffer);
+  };
+#endif
+}
@@ -0,0 +1,205 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//               2020 Eugen Wintersberger <eugen.wintersberger@gmail.com>
+//
+// This file is part of h5pp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace hdf5;
+
+#ifdef H5CPP_WITH_IO_URING
+
+namespace {
+
+std::vector<double> ramp(size_t size) {
+  std::vector<double> data(size);
+  std::iota(data.begin(), data.end(), 0.5);
+  return data;
+}
+
+void write_file(const std::string &name, const file::Driver &driver,
+                const std::vector<double> &data) {
+  property::FileAccessList fapl;
+  property::FileCreationList fcpl;
+  driver(fapl);
+  auto f = file::create(name, file::AccessFlags::Truncate, fcpl, fapl);
+  auto root = f.root();
+  root.attributes.create_from<std::string>("NX_class", "NXroot");
+
+  property::DatasetCreationList dcpl;
+  dcpl.layout(property::DatasetLayout::Chunked);
+  dcpl.chunk({1000});
+  node::Dataset chunked(root, "chunked", datatype::create<double>(),
+                        dataspace::Simple({data.size()}),
+                        property::LinkCreationList(), dcpl);
+  chunked.write(data);
+  node::Dataset contiguous(root, "contiguous", datatype::create<double>(),
+                           dataspace::Simple({data.size()}));
+  contiguous.write(data);
+}
+
+std::vector<double> read_file(const std::string &name, const file::Driver &driver,
+                              const std::string &dataset) {
+  property::FileAccessList fapl;
+  driver(fapl);
+  auto f = file::open(name, file::AccessFlags::ReadOnly, fapl);
+  node::Dataset d = f.root()[dataset];
+  std::vector<double> data(d.dataspace().size());
+  d.read(data);
+  return data;
+}
+
+}  // namespace
+
+SCENARIO("Construction of an io_uring driver instance", "[file,h5cpp,driver]") {
+  GIVEN("a default constructed instance") {
+    file::IoUringDriver d;
+    THEN("all parameters have their default values") {
+      REQUIRE(d.id() == file::DriverID::IoUring);
+      REQUIRE(d.queue_depth() == 16u);
+      REQUIRE(d.block_size() == 1024ul * 1024ul);
+      REQUIRE_FALSE(d.direct());
+      REQUIRE_FALSE(d.registered_buffers());
+    }
+    WHEN("changing the parameters") {
+      d.queue_depth(64);
+      d.block_size(8192);
+      d.direct(true);
+      d.registered_buffers(true);
+      THEN("the new values are returned") {
+        REQUIRE(d.queue_depth() == 64u);
+        REQUIRE(d.block_size() == 8192ul);
+        REQUIRE(d.direct());
+        REQUIRE(d.registered_buffers());
+      }
+    }
+    THEN("invalid parameters are rejected") {
+      REQUIRE_THROWS_AS(d.queue_depth(0), std::runtime_error);
+      REQUIRE_THROWS_AS(d.queue_depth(5000), std::runtime_error);
+      REQUIRE_THROWS_AS(d.block_size(0), std::runtime_error);
+      d.block_size(1000);
+      REQUIRE_THROWS_AS(d.direct(true), std::runtime_error);
+      REQUIRE_THROWS_AS(file::IoUringDriver(8, 1000, true), std::runtime_error);
+    }
+  }
+}
+
+SCENARIO("Reading and writing files with the io_uring driver",
+         "[file,h5cpp,driver]") {
+  // a small block size and queue depth split transfers into several batches
+  auto configuration = GENERATE(
+      file::IoUringDriver(),
+      file::IoUringDriver(4, 4096),
+      file::IoUringDriver(4, 4096, true),
+      file::IoUringDriver(4, 8192, false, true),
+      file::IoUringDriver(3, 4096, true, true));
+  auto data = ramp(10001);
+  std::string name = "io_uring_driver_test.h5";
+
+  GIVEN("a file written with the driver") {
+    write_file(name, configuration, data);
+    THEN("the file can be read with the POSIX driver") {
+      REQUIRE(read_file(name, file::PosixDriver(), "chunked") == data);
+      REQUIRE(read_file(name, file::PosixDriver(), "contiguous") == data);
+    }
+    THEN("the file can be read with the driver") {
+      REQUIRE(read_file(name, configuration, "chunked") == data);
+      REQUIRE(read_file(name, configuration, "contiguous") == data);
+    }
+  }
+
+  GIVEN("a file written with the POSIX driver") {
+    write_file(name, file::PosixDriver(), data);
+    THEN("the file can be read with the driver") {
+      REQUIRE(read_file(name, configuration, "chunked") == data);
+      REQUIRE(read_file(name, configuration, "contiguous") == data);
+    }
+    AND_WHEN("modifying the file with the driver") {
+      property::FileAccessList fapl;
+      configuration(fapl);
+      {
+        auto f = file::open(name, file::AccessFlags::ReadWrite, fapl);
+        node::Dataset d = f.root()["chunked"];
+        std::vector<double> part{-1.0, -2.0, -3.0};
+        d.write(part, dataspace::Hyperslab{{4999}, {3}});
+        f.root().attributes.create_from<int>("modified", 1);
+      }
+      THEN("the changes are seen by the POSIX driver") {
+        auto expected = data;
+        expected[4999] = -1.0;
+        expected[5000] = -2.0;
+        expected[5001] = -3.0;
+        REQUIRE(read_file(name, file::PosixDriver(), "chunked") == expected);
+        REQUIRE(read_file(name, file::PosixDriver(), "contiguous") == data);
+      }
+    }
+  }
+}
+
+SCENARIO("Opening a missing file with the io_uring driver", "[file,h5cpp,driver]") {
+  property::FileAccessList fapl;
+  file::IoUringDriver()(fapl);
+  REQUIRE_THROWS_AS(file::open("io_uring_missing.h5", file::AccessFlags::ReadOnly, fapl),
+                    std::runtime_error);
+}
+
+SCENARIO("Raw data throughput of the file drivers", "[benchmark]") {
+  auto data = ramp(2 * 1024 * 1024);
+  std::vector<double> buffer(data.size());
+  std::string name = "io_uring_driver_benchmark.h5";
+  property::FileCreationList fcpl;
+  property::DatasetCreationList dcpl;
+  dcpl.layout(property::DatasetLayout::Chunked);
+  dcpl.chunk({128 * 1024});
+
+  auto run = [&](const file::Driver &driver) {
+    property::FileAccessList fapl;
+    driver(fapl);
+    {
+      auto f = file::create(name, file::AccessFlags::Truncate, fcpl, fapl);
+      node::Dataset d(f.root(), "data", datatype::create<double>(),
+                      dataspace::Simple({data.size()}),
+                      property::LinkCreationList(), dcpl);
+      d.write(data);
+    }
+    auto f = file::open(name, file::AccessFlags::ReadOnly, fapl);
+    node::Dataset d = f.root()["data"];
+    d.read(buffer);
+    return buffer.back();
+  };
+
+  BENCHMARK("POSIX driver") { return run(file::PosixDriver()); };
+  BENCHMARK("io_uring driver") { return run(file::IoUringDriver(16, 256 * 1024)); };
+  BENCHMARK("io_uring driver with O_DIRECT") {
+    return run(file::IoUringDriver(16, 256 * 1024, true, true));
+  };
+}
+
+#endif
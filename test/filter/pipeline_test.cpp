@@ -0,0 +1,122 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+#include <h5cpp/contrib/stl/stl.hpp>
+#include <cstring>
+#include <numeric>
+
+using namespace hdf5;
+
+namespace {
+
+filter::FilterPipeline::Buffer raw_chunk(const node::Dataset &dataset,
+                                          std::uint32_t &filter_mask) {
+  Dimensions offset{0};
+  hsize_t size = dataset.chunk_storage_size(offset);
+  filter::FilterPipeline::Buffer buffer(size);
+  H5Dread_chunk(static_cast<hid_t>(dataset), H5P_DEFAULT, offset.data(),
+                &filter_mask, buffer.data());
+  return buffer;
+}
+
+}  // namespace
+
+SCENARIO("applying dataset filters outside of libhdf5") {
+  auto f = file::create("filter_pipeline_test.h5", file::AccessFlags::Truncate);
+  const size_t nelements = 4096;
+  std::vector<int> data(nelements);
+  std::iota(data.begin(), data.end(), 0);
+  dataspace::Simple space{{nelements}};
+
+  GIVEN("a dataset with shuffle, deflate and fletcher32") {
+    property::DatasetCreationList dcpl;
+    dcpl.layout(property::DatasetLayout::Chunked);
+    dcpl.chunk({nelements});
+    filter::Shuffle()(dcpl);
+    filter::Deflate(6)(dcpl);
+    filter::Fletcher32()(dcpl);
+    node::Dataset dataset(f.root(), "data", datatype::create<int>(), space,
+                          property::LinkCreationList(), dcpl);
+    dataset.write(data);
+
+    filter::FilterPipeline pipeline(dataset.creation_list(), sizeof(int));
+    REQUIRE(pipeline.size() == 3ul);
+    REQUIRE_FALSE(pipeline.empty());
+
+    std::uint32_t filter_mask = 0;
+    auto stored = raw_chunk(dataset, filter_mask);
+    REQUIRE(filter_mask == 0u);
+
+    THEN("encoding produces the same bytes as libhdf5") {
+      filter::FilterPipeline::Buffer buffer(nelements * sizeof(int));
+      std::memcpy(buffer.data(), data.data(), buffer.size());
+      REQUIRE(pipeline.encode(buffer) == 0u);
+      REQUIRE(buffer == stored);
+    }
+    AND_THEN("the chunk written by libhdf5 can be decoded") {
+      pipeline.decode(stored, filter_mask, nelements * sizeof(int));
+      REQUIRE(stored.size() == nelements * sizeof(int));
+      REQUIRE(std::memcmp(stored.data(), data.data(), stored.size()) == 0);
+    }
+    AND_THEN("decoding a corrupted chunk fails") {
+      stored[stored.size() / 2] ^= 0xff;
+      REQUIRE_THROWS_AS(pipeline.decode(stored), std::runtime_error);
+    }
+    AND_THEN("decoding works without a size hint") {
+      pipeline.decode(stored);
+      REQUIRE(stored.size() == nelements * sizeof(int));
+    }
+  }
+
+  GIVEN("a dataset without filters") {
+    property::DatasetCreationList dcpl;
+    dcpl.layout(property::DatasetLayout::Chunked);
+    dcpl.chunk({nelements});
+    node::Dataset dataset(f.root(), "plain", datatype::create<int>(), space,
+                          property::LinkCreationList(), dcpl);
+    filter::FilterPipeline pipeline(dataset.creation_list(), sizeof(int));
+    THEN("the pipeline is empty and leaves the data untouched") {
+      REQUIRE(pipeline.empty());
+      filter::FilterPipeline::Buffer buffer(16, 1);
+      REQUIRE(pipeline.encode(buffer) == 0u);
+      REQUIRE(buffer == filter::FilterPipeline::Buffer(16, 1));
+    }
+  }
+
+  GIVEN("an unsupported filter") {
+    filter::ExternalFilters filters;
+    filters.push_back(filter::ExternalFilter(32001, {}, "blosc"));
+    THEN("construction fails if the filter is mandatory") {
+      REQUIRE_THROWS_AS(filter::FilterPipeline(filters, 4),
+                        std::runtime_error);
+      REQUIRE_FALSE(filter::FilterPipeline::is_supported(32001));
+      REQUIRE(filter::FilterPipeline::is_supported(H5Z_FILTER_DEFLATE));
+    }
+  }
+}
@@ -0,0 +1,121 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+using namespace hdf5;
+
+SCENARIO("asynchronous dataset IO") {
+  auto f = file::create("async_dataset_test.h5", file::AccessFlags::Truncate);
+  using Frame = std::vector<int>;
+  const size_t frame_size = 1024;
+  const size_t nframes = 16;
+
+  dataspace::Simple space{{nframes, frame_size}};
+  property::DatasetCreationList dcpl;
+  dcpl.layout(property::DatasetLayout::Chunked);
+  dcpl.chunk({1, frame_size});
+  node::Dataset dataset(f.root(), "data", datatype::create<int>(), space,
+                        property::LinkCreationList(), dcpl);
+
+  GIVEN("an asynchronous facade for the dataset") {
+    node::AsyncDataset async(dataset);
+    REQUIRE(async.dataset().link().path() == "/data");
+
+    WHEN("writing frame by frame") {
+      std::atomic<size_t> completed{0};
+      std::vector<std::future<void>> writes;
+      for (size_t index = 0; index < nframes; ++index) {
+        Frame frame(frame_size);
+        std::iota(frame.begin(), frame.end(), static_cast<int>(index * frame_size));
+        dataspace::Hyperslab selection{{index, 0}, {1, frame_size}};
+        writes.push_back(async.write(std::move(frame), selection,
+                                     [&completed](std::exception_ptr error) {
+                                       if (!error) ++completed;
+                                     }));
+      }
+      for (auto& write : writes) write.get();
+
+      THEN("all callbacks have been called") {
+        REQUIRE(completed == nframes);
+        async.wait();
+        REQUIRE(async.pending() == 0ul);
+      }
+      AND_THEN("we can read the data back asynchronously") {
+        auto all = async.read(Frame(nframes * frame_size)).get();
+        Frame expected(nframes * frame_size);
+        std::iota(expected.begin(), expected.end(), 0);
+        REQUIRE(all == expected);
+      }
+      AND_THEN("we can read a single frame") {
+        dataspace::Hyperslab selection{{3, 0}, {1, frame_size}};
+        auto frame = async.read(Frame(frame_size), selection).get();
+        REQUIRE(frame.front() == static_cast<int>(3 * frame_size));
+        REQUIRE(frame.back() == static_cast<int>(4 * frame_size - 1));
+      }
+    }
+
+    WHEN("an operation fails") {
+      std::exception_ptr reported;
+      dataspace::Hyperslab selection{{nframes, 0}, {1, frame_size}};
+      auto write = async.write(Frame(frame_size), selection,
+                               [&reported](std::exception_ptr error) {
+                                 reported = error;
+                               });
+      THEN("the error is delivered via the future and the callback") {
+        REQUIRE_THROWS(write.get());
+        REQUIRE(reported != nullptr);
+      }
+      AND_THEN("subsequent operations still succeed") {
+        REQUIRE_NOTHROW(async.write(Frame(nframes * frame_size, 1)).get());
+      }
+    }
+
+    WHEN("the facade is destroyed with pending operations") {
+      {
+        node::AsyncDataset pending(dataset);
+        for (size_t index = 0; index < nframes; ++index)
+          pending.write(Frame(frame_size, 7),
+                        dataspace::Hyperslab{{index, 0}, {1, frame_size}});
+      }
+      THEN("all operations have been executed") {
+        Frame data(nframes * frame_size);
+        dataset.read(data);
+        REQUIRE(std::all_of(data.begin(), data.end(),
+                            [](int value) { return value == 7; }));
+      }
+    }
+  }
+
+  GIVEN("an invalid dataset") {
+    REQUIRE_THROWS_AS(node::AsyncDataset(node::Dataset()), std::runtime_error);
+  }
+}
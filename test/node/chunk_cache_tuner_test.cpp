@@ -0,0 +1,188 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//               2020 Eugen Wintersberger <eugen.wintersberger@gmail.com>
+//
+// This file is part of h5pp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+#include <numeric>
+#include "../utilities.hpp"
+
+using namespace hdf5;
+
+namespace {
+
+node::Dataset create_dataset(const node::Group &base, const std::string &name,
+                             size_t size, size_t chunk, bool filtered) {
+  property::DatasetCreationList dcpl;
+  dcpl.layout(property::DatasetLayout::Chunked);
+  dcpl.chunk({chunk, chunk});
+  if (filtered) filter::Deflate(2)(dcpl);
+  node::Dataset dataset(base, name, datatype::create<float>(),
+                        dataspace::Simple{{size, size}},
+                        property::LinkCreationList(), dcpl);
+  std::vector<float> data(size * size);
+  std::iota(data.begin(), data.end(), 0.0f);
+  dataset.write(data);
+  return dataset;
+}
+
+}  // namespace
+
+SCENARIO("sizing the chunk cache for a selection") {
+  auto f = file::create("chunk_cache_tuner_test.h5", file::AccessFlags::Truncate);
+  auto &tuner = node::ChunkCacheTuner::instance();
+  tuner.clear();
+
+  // 16x16 float chunks hold 1 KiB each
+  const size_t chunk_bytes = 16 * 16 * sizeof(float);
+  auto filtered = create_dataset(f.root(), "filtered", 64, 16, true);
+  auto plain = create_dataset(f.root(), "plain", 64, 16, false);
+
+  GIVEN("a column of a filtered dataset") {
+    dataspace::Hyperslab column{{0, 5}, {64, 1}};
+    auto params = tuner.suggest(filtered, column);
+    THEN("the cache holds all chunks along the column") {
+      REQUIRE(params.chunk_cache_size() == 4 * chunk_bytes);
+      REQUIRE(params.chunk_slots() == 521ul);
+    }
+  }
+
+  GIVEN("a selection covering whole chunks") {
+    dataspace::Hyperslab block{{16, 0}, {16, 64}};
+    THEN("no cache is used") {
+      REQUIRE(tuner.suggest(filtered, block).chunk_cache_size() == 0ul);
+      REQUIRE(tuner.suggest(plain, block).chunk_cache_size() == 0ul);
+    }
+  }
+
+  GIVEN("a strided selection within the bounding box of whole chunks") {
+    dataspace::Hyperslab points{{0, 0}, {32, 16}, {2, 2}};
+    THEN("the chunks are cached") {
+      REQUIRE(tuner.suggest(filtered, points).chunk_cache_size() ==
+              8 * chunk_bytes);
+    }
+  }
+
+  GIVEN("a contiguous dataset") {
+    node::Dataset contiguous(f.root(), "contiguous", datatype::create<int>(),
+                             dataspace::Simple{{10}});
+    THEN("no parameters can be suggested") {
+      REQUIRE_THROWS_AS(tuner.suggest(contiguous, dataspace::Hyperslab{{0}, {5}}),
+                        std::runtime_error);
+    }
+  }
+
+  GIVEN("a tuned dataset") {
+    dataspace::Hyperslab column{{0, 5}, {64, 1}};
+    auto params = tuner.tune(filtered, column);
+
+    THEN("the dataset is reopened with the suggested parameters") {
+      REQUIRE(params.chunk_cache_size() == 4 * chunk_bytes);
+      REQUIRE(filtered.access_list().chunk_cache_parameters().chunk_cache_size() ==
+              4 * chunk_bytes);
+      REQUIRE(filtered.link().path() == Path("/filtered"));
+      REQUIRE(tuner.reserved() == 4 * chunk_bytes);
+
+      std::vector<float> data(64);
+      filtered.read(data, column);
+      REQUIRE(data[1] == 69.0f);
+    }
+
+    WHEN("tuning the dataset again") {
+      tuner.tune(filtered, dataspace::Hyperslab{{5, 0}, {1, 64}});
+      THEN("the previous reservation is replaced") {
+        REQUIRE(tuner.reserved() == 4 * chunk_bytes);
+      }
+    }
+
+    WHEN("the dataset is closed") {
+      close(filtered);
+      THEN("its reservation is released") {
+        REQUIRE(tuner.reserved() == 0ul);
+      }
+    }
+
+    WHEN("the reservation is released") {
+      tuner.release(filtered);
+      THEN("nothing is reserved") { REQUIRE(tuner.reserved() == 0ul); }
+    }
+  }
+
+  GIVEN("a ceiling below the required cache size") {
+    auto second = create_dataset(f.root(), "second", 64, 16, true);
+    tuner.ceiling(6 * chunk_bytes);
+    dataspace::Hyperslab column{{0, 5}, {64, 1}};
+    tuner.tune(filtered, column);
+    REQUIRE(tuner.reserved() == 4 * chunk_bytes);
+
+    THEN("an unfiltered dataset reads directly from the file") {
+      REQUIRE(tuner.tune(plain, column).chunk_cache_size() == 0ul);
+      REQUIRE(tuner.reserved() == 4 * chunk_bytes);
+    }
+
+    THEN("a filtered dataset gets the remaining budget") {
+      auto params = tuner.tune(second, column);
+      REQUIRE(params.chunk_cache_size() == 2 * chunk_bytes);
+      REQUIRE(tuner.reserved() == 6 * chunk_bytes);
+    }
+  }
+
+  tuner.clear();
+}
+
+SCENARIO("chunk cache tuner performance") {
+  auto f = file::create("chunk_cache_tuner_speed.h5", file::AccessFlags::Truncate);
+  auto &tuner = node::ChunkCacheTuner::instance();
+  tuner.clear();
+
+  // 1024x1024 float chunks hold 4 MiB each
+  const size_t size = 2048;
+  auto dataset = create_dataset(f.root(), "data", size, 1024, true);
+  close(dataset);
+  std::vector<float> column(size);
+  size_t index = 0;
+
+  auto read_column = [&](const node::Dataset &data) {
+    index = (index + 1) % size;
+    data.read(column, dataspace::Hyperslab{{0, index}, {size, 1}});
+    return column[1];
+  };
+
+  auto reference = f.root().get_dataset("data");
+  BENCHMARK("reading a column with the default chunk cache") {
+    return read_column(reference);
+  };
+  close(reference);
+
+  auto tuned = f.root().get_dataset("data");
+  tuner.tune(tuned, dataspace::Hyperslab{{0, 0}, {size, 1}});
+  BENCHMARK("reading a column with a tuned chunk cache") {
+    return read_column(tuned);
+  };
+
+  tuner.clear();
+}
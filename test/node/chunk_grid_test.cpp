@@ -0,0 +1,86 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+#include <numeric>
+
+using namespace hdf5;
+
+SCENARIO("chunks intersecting a block") {
+  GIVEN("a block aligned to the chunks") {
+    node::ChunkGrid grid({2, 4}, {2, 0}, {4, 8});
+    THEN("we get four complete chunks") {
+      REQUIRE(grid.size() == 4ul);
+      REQUIRE(grid.chunk_elements() == 8ul);
+      REQUIRE(grid.block_elements() == 32ul);
+      REQUIRE(grid.chunk_offset(0) == Dimensions{2, 0});
+      REQUIRE(grid.chunk_offset(1) == Dimensions{2, 4});
+      REQUIRE(grid.chunk_offset(2) == Dimensions{4, 0});
+      REQUIRE(grid.chunk_offset(3) == Dimensions{4, 4});
+      for (size_t index = 0; index < grid.size(); ++index)
+        REQUIRE(grid.covers(index));
+      REQUIRE_THROWS_AS(grid.chunk_offset(4), std::out_of_range);
+    }
+    AND_THEN("gathering and scattering restores the block") {
+      std::vector<int> block(32), result(32, -1);
+      std::iota(block.begin(), block.end(), 0);
+      for (size_t index = 0; index < grid.size(); ++index) {
+        std::vector<int> chunk(8);
+        grid.gather(block.data(), index, chunk.data(), sizeof(int));
+        grid.scatter(chunk.data(), index, result.data(), sizeof(int));
+      }
+      REQUIRE(result == block);
+
+      std::vector<int> chunk(8);
+      grid.gather(block.data(), 1, chunk.data(), sizeof(int));
+      REQUIRE(chunk == std::vector<int>{4, 5, 6, 7, 12, 13, 14, 15});
+    }
+  }
+
+  GIVEN("a block not aligned to the chunks") {
+    node::ChunkGrid grid({4}, {3}, {6});
+    THEN("the partially covered chunks are included") {
+      REQUIRE(grid.size() == 3ul);
+      REQUIRE_FALSE(grid.covers(0));
+      REQUIRE(grid.covers(1));
+      REQUIRE_FALSE(grid.covers(2));
+
+      std::vector<int> block{1, 2, 3, 4, 5, 6};
+      std::vector<int> chunk(4, 0);
+      grid.gather(block.data(), 0, chunk.data(), sizeof(int));
+      REQUIRE(chunk == std::vector<int>{0, 0, 0, 1});
+      grid.gather(block.data(), 2, chunk.data(), sizeof(int));
+      REQUIRE(chunk == std::vector<int>{6, 0, 0, 1});
+    }
+  }
+
+  GIVEN("inconsistent ranks") {
+    REQUIRE_THROWS_AS(node::ChunkGrid({4}, {0, 0}, {4, 4}), std::runtime_error);
+    REQUIRE_THROWS_AS(node::ChunkGrid({0}, {0}, {4}), std::runtime_error);
+  }
+}
@@ -0,0 +1,170 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+
+using namespace hdf5;
+
+#if H5_VERSION_GE(1, 10, 2)
+
+namespace {
+const hsize_t xdim = 256;
+const hsize_t ydim = 256;
+const hsize_t frames_per_chunk = 4;
+const hsize_t nframes = 30;
+
+template<typename T>
+node::Dataset create_dataset(const node::Group& base, const std::string& name,
+                             hsize_t frames) {
+  dataspace::Simple space{{frames, xdim, ydim},
+                          {dataspace::Simple::unlimited, xdim, ydim}};
+  property::DatasetCreationList dcpl;
+  dcpl.layout(property::DatasetLayout::Chunked);
+  dcpl.chunk({frames_per_chunk, xdim / 2, ydim / 2});
+  filter::Shuffle()(dcpl);
+  filter::Deflate(2)(dcpl);
+  return node::Dataset(base, name, datatype::create<T>(), space,
+                       property::LinkCreationList(), dcpl);
+}
+
+template<typename T>
+std::vector<T> create_frames(hsize_t n) {
+  std::vector<T> frames(n * xdim * ydim);
+  for (size_t index = 0; index < frames.size(); ++index)
+    frames[index] = static_cast<T>(index % 1021);
+  return frames;
+}
+}  // namespace
+
+SCENARIO("reading compressed chunks in parallel") {
+  auto f = file::create("chunk_reader_test.h5", file::AccessFlags::Truncate);
+
+  GIVEN("a compressed dataset written by libhdf5") {
+    auto frames = create_frames<unsigned short>(nframes);
+    auto dataset = create_dataset<unsigned short>(f.root(), "data", nframes);
+    dataset.write(frames);
+    node::ChunkReader reader(dataset, 4);
+    REQUIRE(reader.threads() == 4ul);
+
+    THEN("the entire dataset can be read") {
+      std::vector<unsigned short> result(frames.size());
+      reader.read(result);
+      REQUIRE(result == frames);
+    }
+
+    THEN("a block not aligned to the chunks can be read") {
+      dataspace::Hyperslab selection{{3, 100, 17}, {9, 50, 200}};
+      std::vector<unsigned short> expected(selection.size());
+      std::vector<unsigned short> result(selection.size());
+      dataset.read(expected, selection);
+      reader.read(result, selection);
+      REQUIRE(result == expected);
+    }
+
+    THEN("reading with a different memory type fails") {
+      std::vector<double> result(frames.size());
+      REQUIRE_THROWS_AS(reader.read(result), std::runtime_error);
+    }
+
+    THEN("reading with a wrong number of elements fails") {
+      std::vector<unsigned short> result(10);
+      REQUIRE_THROWS_AS(reader.read(result), std::runtime_error);
+    }
+
+    THEN("reading beyond the extent fails") {
+      std::vector<unsigned short> result(frames_per_chunk * xdim * ydim);
+      REQUIRE_THROWS_AS(
+          reader.read(result.data(), {nframes - 1, 0, 0}, {frames_per_chunk, xdim, ydim}),
+          std::runtime_error);
+    }
+  }
+
+  GIVEN("a float dataset with unallocated chunks") {
+    property::DatasetCreationList dcpl;
+    dcpl.layout(property::DatasetLayout::Chunked);
+    dcpl.chunk({frames_per_chunk, xdim, ydim});
+    dcpl.fill_value(-1.5f);
+    filter::Deflate(2)(dcpl);
+    node::Dataset dataset(f.root(), "floats", datatype::create<float>(),
+                          dataspace::Simple{{2 * frames_per_chunk, xdim, ydim}},
+                          property::LinkCreationList(), dcpl);
+    auto frames = create_frames<float>(frames_per_chunk);
+    dataset.write(frames, dataspace::Hyperslab{{0, 0, 0}, {frames_per_chunk, xdim, ydim}});
+
+    THEN("the raw chunk can be read") {
+      std::vector<unsigned char> chunk(dataset.chunk_storage_size({0, 0, 0}));
+      REQUIRE(dataset.read_chunk(chunk, {0, 0, 0}) == 0u);
+    }
+
+    THEN("missing chunks are filled with the fill value") {
+      node::ChunkReader reader(dataset);
+      std::vector<float> result(2 * frames.size());
+      reader.read(result);
+      REQUIRE(std::equal(frames.begin(), frames.end(), result.begin()));
+      REQUIRE(std::all_of(result.begin() + static_cast<std::ptrdiff_t>(frames.size()),
+                          result.end(), [](float v) { return v == -1.5f; }));
+    }
+  }
+
+  GIVEN("a contiguous dataset") {
+    node::Dataset dataset(f.root(), "contiguous", datatype::create<int>(),
+                          dataspace::Simple{{10}});
+    THEN("a chunk reader cannot be constructed") {
+      REQUIRE_THROWS_AS(node::ChunkReader(dataset), std::runtime_error);
+    }
+  }
+
+  GIVEN("a dataset with variable length strings") {
+    property::DatasetCreationList dcpl;
+    dcpl.layout(property::DatasetLayout::Chunked);
+    dcpl.chunk({2});
+    node::Dataset dataset(f.root(), "strings", datatype::create<std::string>(),
+                          dataspace::Simple{{10}}, property::LinkCreationList(), dcpl);
+    THEN("a chunk reader cannot be constructed") {
+      REQUIRE_THROWS_AS(node::ChunkReader(dataset), std::runtime_error);
+    }
+  }
+}
+
+SCENARIO("chunk reader performance") {
+  auto f = file::create("chunk_reader_speed.h5", file::AccessFlags::Truncate);
+  auto frames = create_frames<unsigned short>(nframes);
+  auto dataset = create_dataset<unsigned short>(f.root(), "data", nframes);
+  dataset.write(frames);
+  node::ChunkReader reader(dataset);
+  std::vector<unsigned short> result(frames.size());
+
+  BENCHMARK("reading compressed frames with libhdf5") {
+    dataset.read(result);
+  };
+  BENCHMARK("reading compressed frames with the chunk reader") {
+    reader.read(result);
+  };
+}
+
+#endif
@@ -0,0 +1,150 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+#include <numeric>
+
+using namespace hdf5;
+
+namespace {
+const hsize_t xdim = 256;
+const hsize_t ydim = 256;
+const hsize_t frames_per_chunk = 4;
+const hsize_t nframes = 30;
+
+using Frames = std::vector<unsigned short>;
+
+node::Dataset create_dataset(const node::Group& base, const std::string& name) {
+  dataspace::Simple space{{0, xdim, ydim},
+                          {dataspace::Simple::unlimited, xdim, ydim}};
+  property::DatasetCreationList dcpl;
+  dcpl.layout(property::DatasetLayout::Chunked);
+  dcpl.chunk({frames_per_chunk, xdim, ydim});
+  filter::Shuffle()(dcpl);
+  filter::Deflate(2)(dcpl);
+  return node::Dataset(base, name, datatype::create<unsigned short>(), space,
+                       property::LinkCreationList(), dcpl);
+}
+
+Frames create_frames(hsize_t n) {
+  Frames frames(n * xdim * ydim);
+  for (size_t index = 0; index < frames.size(); ++index)
+    frames[index] = static_cast<unsigned short>(index % 1021);
+  return frames;
+}
+}  // namespace
+
+SCENARIO("writing compressed chunks in parallel") {
+  auto f = file::create("chunk_writer_test.h5", file::AccessFlags::Truncate);
+  auto frames = create_frames(nframes);
+
+  GIVEN("a compressed dataset and a chunk writer") {
+    auto dataset = create_dataset(f.root(), "data");
+    node::ChunkWriter writer(dataset, 4);
+    REQUIRE(writer.threads() == 4ul);
+    REQUIRE(writer.dataset().link().path() == "/data");
+
+    WHEN("writing all frames at once") {
+      dataset.extent(0, nframes);
+      writer.write(frames, dataspace::Hyperslab{{0, 0, 0}, {nframes, xdim, ydim}});
+      THEN("the data can be read back by libhdf5") {
+        Frames result(frames.size());
+        dataset.read(result);
+        REQUIRE(result == frames);
+      }
+      AND_THEN("the chunks are stored compressed") {
+        REQUIRE(dataset.chunk_storage_size({0, 0, 0}) <
+                frames_per_chunk * xdim * ydim * sizeof(unsigned short));
+      }
+    }
+
+    WHEN("appending blocks of frames") {
+      Frames block(frames.begin(),
+                   frames.begin() + static_cast<std::ptrdiff_t>(2 * frames_per_chunk * xdim * ydim));
+      dataset.extent(0, 2 * frames_per_chunk);
+      writer.write(block.data(), {0, 0, 0}, {2 * frames_per_chunk, xdim, ydim});
+      dataset.extent(0, 2 * frames_per_chunk);
+      writer.write(block.data(), {2 * frames_per_chunk, 0, 0},
+                   {2 * frames_per_chunk, xdim, ydim});
+      THEN("both blocks are stored") {
+        Frames result(4 * frames_per_chunk * xdim * ydim);
+        dataset.read(result);
+        REQUIRE(std::equal(block.begin(), block.end(), result.begin()));
+        REQUIRE(std::equal(block.begin(), block.end(),
+                           result.begin() + static_cast<std::ptrdiff_t>(block.size())));
+      }
+    }
+
+    WHEN("the block is not aligned to the chunks") {
+      dataset.extent(0, nframes);
+      THEN("writing fails") {
+        REQUIRE_THROWS_AS(writer.write(frames.data(), {1, 0, 0}, {4, xdim, ydim}),
+                          std::runtime_error);
+        REQUIRE_THROWS_AS(writer.write(frames.data(), {0, 0, 0}, {3, xdim, ydim}),
+                          std::runtime_error);
+        REQUIRE_THROWS_AS(writer.write(frames.data(), {28, 0, 0}, {4, xdim, ydim}),
+                          std::runtime_error);
+      }
+    }
+
+    WHEN("the memory type does not match the file type") {
+      dataset.extent(0, frames_per_chunk);
+      std::vector<double> data(frames_per_chunk * xdim * ydim);
+      THEN("writing fails") {
+        REQUIRE_THROWS_AS(
+            writer.write(data, dataspace::Hyperslab{{0, 0, 0}, {frames_per_chunk, xdim, ydim}}),
+            std::runtime_error);
+      }
+    }
+  }
+
+  GIVEN("a contiguous dataset") {
+    node::Dataset dataset(f.root(), "contiguous", datatype::create<int>(),
+                          dataspace::Simple{{10}});
+    THEN("a chunk writer cannot be constructed") {
+      REQUIRE_THROWS_AS(node::ChunkWriter(dataset), std::runtime_error);
+    }
+  }
+}
+
+SCENARIO("chunk writer performance") {
+  auto f = file::create("chunk_writer_speed.h5", file::AccessFlags::Truncate);
+  auto frames = create_frames(nframes);
+  auto reference = create_dataset(f.root(), "reference");
+  auto parallel = create_dataset(f.root(), "parallel");
+  reference.extent(0, nframes);
+  parallel.extent(0, nframes);
+  node::ChunkWriter writer(parallel);
+
+  BENCHMARK("writing compressed frames with libhdf5") {
+    reference.write(frames);
+  };
+  BENCHMARK("writing compressed frames with the chunk writer") {
+    writer.write(frames.data(), {0, 0, 0}, {nframes, xdim, ydim});
+  };
+}
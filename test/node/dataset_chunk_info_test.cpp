@@ -0,0 +1,94 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+#include <algorithm>
+
+using namespace hdf5;
+
+#if H5_VERSION_GE(1, 10, 5)
+
+SCENARIO("querying the chunk index of a dataset") {
+  auto f = file::create("dataset_chunk_info_test.h5", file::AccessFlags::Truncate);
+  property::DatasetCreationList dcpl;
+  filter::Deflate(4)(dcpl);
+  node::ChunkedDataset dataset(f.root(), "data", datatype::create<int>(),
+                               dataspace::Simple{{8, 8}}, {4, 4},
+                               property::LinkCreationList(), dcpl);
+
+  GIVEN("a dataset without data") {
+    THEN("no chunks are allocated") {
+      REQUIRE(dataset.chunk_count() == 0ul);
+      REQUIRE(dataset.chunks().empty());
+      auto info = dataset.chunk_info({4, 4});
+      REQUIRE_FALSE(info.is_allocated());
+      REQUIRE(info.size == 0ul);
+      REQUIRE(info.offset == Dimensions{4, 4});
+    }
+  }
+
+  GIVEN("a dataset with three chunks written") {
+    std::vector<int> block(16, 1);
+    dataset.write(block, dataspace::Hyperslab{{0, 0}, {4, 4}});
+    dataset.write(block, dataspace::Hyperslab{{0, 4}, {4, 4}});
+    dataset.write(block, dataspace::Hyperslab{{4, 4}, {4, 4}});
+    f.flush(file::Scope::Global);
+
+    THEN("all three chunks are listed") {
+      REQUIRE(dataset.chunk_count() == 3ul);
+      auto chunks = dataset.chunks();
+      REQUIRE(chunks.size() == 3ul);
+      std::vector<Dimensions> offsets;
+      for (const auto& info : chunks) {
+        REQUIRE(info.is_allocated());
+        REQUIRE(info.filter_mask == 0u);
+        REQUIRE(info.size == dataset.chunk_storage_size(info.offset));
+        offsets.push_back(info.offset);
+      }
+      std::sort(offsets.begin(), offsets.end());
+      REQUIRE(offsets == std::vector<Dimensions>{{0, 0}, {0, 4}, {4, 4}});
+    }
+
+    THEN("the information by index and by offset agree") {
+      for (size_t index = 0; index < dataset.chunk_count(); ++index) {
+        auto by_index = dataset.chunk_info_by_index(index);
+        auto by_offset = dataset.chunk_info(by_index.offset);
+        REQUIRE(by_index.address == by_offset.address);
+        REQUIRE(by_index.size == by_offset.size);
+      }
+      REQUIRE_FALSE(dataset.chunk_info({4, 0}).is_allocated());
+    }
+
+    THEN("invalid requests fail") {
+      REQUIRE_THROWS_AS(dataset.chunk_info_by_index(3), std::runtime_error);
+      REQUIRE_THROWS_AS(dataset.chunk_info({0}), std::runtime_error);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,194 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <cstdint>
+#include <h5cpp/hdf5.hpp>
+#include <vector>
+
+namespace {
+
+struct Hit {
+  double energy;
+  std::uint32_t pixel;
+  float time;
+};
+
+bool operator==(const Hit& lhs, const Hit& rhs) {
+  return lhs.energy == rhs.energy && lhs.pixel == rhs.pixel &&
+         lhs.time == rhs.time;
+}
+
+struct Event {
+  double energy;
+  std::uint64_t timestamp;
+  std::uint32_t detector;
+  std::uint32_t channel;
+  double position[3];
+  float weight;
+};
+
+}  // namespace
+
+H5CPP_COMPOUND(Hit, energy, pixel, time)
+
+namespace hdf5 {
+namespace datatype {
+
+template <>
+class TypeTrait<double[3]> {
+ public:
+  using TypeClass = Array;
+  static TypeClass create(const double (&)[3] = {}) {
+    return Array::create(datatype::create<double>(), {3});
+  }
+};
+
+}  // namespace datatype
+}  // namespace hdf5
+
+H5CPP_COMPOUND(Event, energy, timestamp, detector, channel, position, weight)
+
+using namespace hdf5;
+
+SCENARIO("reading and writing reflected compound types") {
+  auto f = file::create("dataset_compound_io.h5", file::AccessFlags::Truncate);
+  std::vector<Hit> write{{1.5, 10, 0.25f}, {2.5, 20, 0.5f}, {3.5, 30, 0.75f}};
+
+  GIVEN("a dataset created with the reflected type") {
+    node::Dataset dataset(f.root(), "hits", datatype::create<Hit>(),
+                          dataspace::Simple{{write.size()}});
+    THEN("we can write and read the data") {
+      dataset.write(write);
+      std::vector<Hit> read(write.size());
+      dataset.read(read);
+      REQUIRE(read == write);
+    }
+  }
+}
+
+SCENARIO("reading and writing single fields of compound datasets") {
+  auto f = file::create("dataset_compound_fields_io.h5",
+                        file::AccessFlags::Truncate);
+  std::vector<Hit> write{{1.5, 10, 0.25f}, {2.5, 20, 0.5f}, {3.5, 30, 0.75f}};
+  node::Dataset dataset(f.root(), "hits", datatype::create<Hit>(),
+                        dataspace::Simple{{write.size()}});
+  dataset.write(write);
+
+  THEN("we can read two fields into separate vectors") {
+    std::vector<double> energy;
+    std::vector<std::uint32_t> pixel;
+    dataset.read_fields({"energy", "pixel"}, energy, pixel);
+    REQUIRE(energy == std::vector<double>{1.5, 2.5, 3.5});
+    REQUIRE(pixel == std::vector<std::uint32_t>{10, 20, 30});
+  }
+  THEN("we can read a single field with a type conversion") {
+    std::vector<double> time;
+    dataset.read_fields({"time"}, time);
+    REQUIRE(time == std::vector<double>{0.25, 0.5, 0.75});
+  }
+  THEN("we can read the fields of a selection") {
+    std::vector<float> time;
+    std::vector<double> energy;
+    dataset.read_fields({"time", "energy"}, dataspace::Hyperslab{{1}, {2}},
+                        time, energy);
+    REQUIRE(time == std::vector<float>{0.5f, 0.75f});
+    REQUIRE(energy == std::vector<double>{2.5, 3.5});
+  }
+  THEN("we can write fields and keep the other fields") {
+    dataset.write_fields({"pixel", "energy"}, std::vector<std::uint32_t>{1, 2, 3},
+                         std::vector<double>{-1.0, -2.0, -3.0});
+    std::vector<Hit> read(write.size());
+    dataset.read(read);
+    REQUIRE(read == std::vector<Hit>{{-1.0, 1, 0.25f}, {-2.0, 2, 0.5f},
+                                     {-3.0, 3, 0.75f}});
+  }
+  THEN("we can write a field of a selection") {
+    dataset.write_fields({"time"}, dataspace::Hyperslab{{2}, {1}},
+                         std::vector<float>{9.0f});
+    std::vector<float> time;
+    dataset.read_fields({"time"}, time);
+    REQUIRE(time == std::vector<float>{0.25f, 0.5f, 9.0f});
+  }
+  THEN("repeated reads reuse the cached memory type") {
+    std::vector<double> energy;
+    dataset.read_fields({"energy"}, energy);
+    auto misses = datatype::TypeCache::instance().misses();
+    dataset.read_fields({"energy"}, energy);
+    REQUIRE(datatype::TypeCache::instance().misses() == misses);
+  }
+  THEN("a missing field fails") {
+    std::vector<double> data;
+    REQUIRE_THROWS_AS(dataset.read_fields({"charge"}, data), std::runtime_error);
+  }
+  THEN("the number of names must match the number of vectors") {
+    std::vector<double> data;
+    REQUIRE_THROWS_AS(dataset.read_fields({"energy", "time"}, data),
+                      std::runtime_error);
+  }
+  THEN("writing fails if the vector size does not match") {
+    REQUIRE_THROWS_AS(dataset.write_fields({"energy"}, std::vector<double>{1.0}),
+                      std::runtime_error);
+  }
+}
+
+SCENARIO("reading compound fields performance") {
+  auto f = file::create("dataset_compound_fields_speed.h5",
+                        file::AccessFlags::Truncate);
+  const size_t count = 100000;
+  std::vector<Event> events(count);
+  for (size_t index = 0; index < count; ++index)
+    events[index] = Event{double(index), index, 1, 2, {0.0, 1.0, 2.0}, 1.0f};
+  node::Dataset dataset(f.root(), "events", datatype::create<Event>(),
+                        dataspace::Simple{{count}});
+  dataset.write(events);
+
+  std::vector<double> energy;
+  std::vector<std::uint64_t> timestamp;
+
+  BENCHMARK("reading all records and extracting two fields") {
+    std::vector<Event> read(count);
+    dataset.read(read);
+    energy.resize(count);
+    timestamp.resize(count);
+    for (size_t index = 0; index < count; ++index) {
+      energy[index] = read[index].energy;
+      timestamp[index] = read[index].timestamp;
+    }
+    return energy.size();
+  };
+
+  BENCHMARK("reading two fields with read_fields") {
+    dataset.read_fields({"energy", "timestamp"}, energy, timestamp);
+    return energy.size();
+  };
+
+  BENCHMARK("reading one field with read_fields") {
+    dataset.read_fields({"energy"}, energy);
+    return energy.size();
+  };
+}
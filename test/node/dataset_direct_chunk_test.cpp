@@ -30,6 +30,9 @@
 #include <catch2/catch_all.hpp>
 #endif
 #include <h5cpp/hdf5.hpp>
+#include <h5cpp/contrib/stl/complex.hpp>
+#include <complex>
+#include <cstring>
 
 using namespace hdf5;
 
@@ -242,3 +245,97 @@ TEST_F(DatasetDirectChunkTest, write_chunk_deflate) {
   EXPECT_EQ(filters[0].name(), "deflate");
 }
 */
+
+SCENARIO("direct chunk access for non-integer types") {
+  auto f = file::create("dataset_direct_chunk_types.h5",
+                        file::AccessFlags::Truncate);
+  property::DatasetCreationList dcpl;
+  dcpl.layout(property::DatasetLayout::Chunked);
+  dcpl.chunk({1, sxdim});
+  auto space = unlimited_space({nframe, sxdim});
+
+  GIVEN("a float dataset") {
+    node::Dataset dataset(f.root(), "floats", datatype::create<float>(), space,
+                          property::LinkCreationList(), dcpl);
+    std::vector<float> frame(sxdim);
+    for (size_t i = 0; i != sxdim; i++) frame[i] = static_cast<float>(i) / 3.f;
+    WHEN("writing the chunks") {
+      for (hsize_t i = 0; i != nframe; i++) dataset.write_chunk(frame, {i, 0});
+      THEN("we can read the data back") {
+        std::vector<float> read_value(sxdim);
+        dataset.read(read_value, dataspace::Hyperslab{{nframe - 1, 0}, {1, sxdim}});
+        REQUIRE(read_value == frame);
+      }
+#if H5_VERSION_GE(1, 10, 2)
+      AND_THEN("we can read the chunks back") {
+        std::vector<float> read_value(sxdim);
+        REQUIRE(dataset.read_chunk(read_value, {2, 0}) == 0u);
+        REQUIRE(read_value == frame);
+      }
+#endif
+    }
+  }
+
+  GIVEN("a compound dataset") {
+    using Complex = std::complex<double>;
+    node::Dataset dataset(f.root(), "complex", datatype::create<Complex>(),
+                          space, property::LinkCreationList(), dcpl);
+    std::vector<Complex> frame(sxdim);
+    for (size_t i = 0; i != sxdim; i++)
+      frame[i] = Complex(static_cast<double>(i), -static_cast<double>(i));
+    WHEN("writing the chunks") {
+      for (hsize_t i = 0; i != nframe; i++) dataset.write_chunk(frame, {i, 0});
+      THEN("we can read the data back") {
+        std::vector<Complex> read_value(sxdim);
+        dataset.read(read_value, dataspace::Hyperslab{{3, 0}, {1, sxdim}});
+        REQUIRE(read_value == frame);
+      }
+    }
+  }
+
+  GIVEN("a compressed dataset") {
+    property::DatasetCreationList cdcpl;
+    cdcpl.layout(property::DatasetLayout::Chunked);
+    cdcpl.chunk({1, sxdim});
+    filter::Deflate(2)(cdcpl);
+    node::Dataset dataset(f.root(), "compressed", datatype::create<float>(),
+                          space, property::LinkCreationList(), cdcpl);
+    std::vector<float> frame(sxdim, 42.f);
+    filter::FilterPipeline pipeline(dataset.creation_list(), sizeof(float));
+    filter::FilterPipeline::Buffer chunk(sxdim * sizeof(float));
+    std::memcpy(chunk.data(), frame.data(), chunk.size());
+    std::uint32_t filter_mask = pipeline.encode(chunk);
+
+    WHEN("writing a pre-compressed chunk from raw memory") {
+      dataset.write_chunk(chunk.data(), chunk.size(), {1, 0}, filter_mask);
+      THEN("libhdf5 decompresses the data") {
+        std::vector<float> read_value(sxdim);
+        dataset.read(read_value, dataspace::Hyperslab{{1, 0}, {1, sxdim}});
+        REQUIRE(read_value == frame);
+      }
+#if H5_VERSION_GE(1, 10, 2)
+      AND_THEN("the raw chunk can be read back") {
+        filter::FilterPipeline::Buffer read_chunk(chunk.size());
+        REQUIRE(dataset.read_chunk(read_chunk.data(), read_chunk.size(), {1, 0}) ==
+                filter_mask);
+        REQUIRE(read_chunk == chunk);
+      }
+      AND_THEN("reading to a too small buffer fails") {
+        filter::FilterPipeline::Buffer read_chunk(chunk.size() - 1);
+        REQUIRE_THROWS_AS(
+            dataset.read_chunk(read_chunk.data(), read_chunk.size(), {1, 0}),
+            std::runtime_error);
+      }
+#endif
+    }
+  }
+
+  GIVEN("a variable length string dataset") {
+    node::Dataset dataset(f.root(), "strings", datatype::create<std::string>(),
+                          space, property::LinkCreationList(), dcpl);
+    std::vector<std::string> frame(sxdim, "hello");
+    THEN("chunks cannot be written") {
+      REQUIRE_THROWS_AS(dataset.write_chunk(frame, {0, 0}), std::runtime_error);
+    }
+  }
+}
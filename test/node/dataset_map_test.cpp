@@ -0,0 +1,118 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+#include <numeric>
+
+using namespace hdf5;
+
+#ifndef _WIN32
+
+SCENARIO("mapping a dataset into memory") {
+  std::vector<int> data(12 * 7);
+  std::iota(data.begin(), data.end(), -20);
+
+  GIVEN("a contiguous dataset with data") {
+    auto f = file::create("dataset_map_test.h5", file::AccessFlags::Truncate);
+    node::Dataset dataset(f.root(), "data", datatype::create<int>(),
+                          dataspace::Simple{{12, 7}});
+    dataset.write(data);
+
+    WHEN("mapping the dataset") {
+      auto mapping = dataset.map();
+      THEN("the mapping describes the dataset") {
+        REQUIRE(mapping.size() == data.size() * sizeof(int));
+        REQUIRE(mapping.shape() == Dimensions{12, 7});
+        REQUIRE(mapping.strides() == Dimensions{7 * sizeof(int), sizeof(int)});
+        REQUIRE(mapping.type() == dataset.datatype());
+      }
+      AND_THEN("the elements can be accessed") {
+        const int* elements = mapping.data<int>();
+        REQUIRE(std::equal(data.begin(), data.end(), elements));
+      }
+      AND_THEN("accessing the elements with a different type fails") {
+        REQUIRE_THROWS_AS(mapping.data<double>(), std::runtime_error);
+      }
+      AND_THEN("the mapping outlives the file") {
+        dataset.close();
+        f.close();
+        node::DatasetMapping moved(std::move(mapping));
+        REQUIRE(mapping.data() == nullptr);
+        REQUIRE(std::equal(data.begin(), data.end(), moved.data<int>()));
+      }
+    }
+  }
+
+  GIVEN("a file opened read-only") {
+    {
+      auto f = file::create("dataset_map_test.h5", file::AccessFlags::Truncate);
+      node::Dataset(f.root(), "data", datatype::create<int>(),
+                    dataspace::Simple{{12, 7}}).write(data);
+    }
+    auto f = file::open("dataset_map_test.h5", file::AccessFlags::ReadOnly);
+    auto mapping = node::get_dataset(f.root(), "data").map();
+    THEN("the dataset can be mapped") {
+      REQUIRE(std::equal(data.begin(), data.end(), mapping.data<int>()));
+    }
+  }
+
+  GIVEN("datasets which cannot be mapped") {
+    auto f = file::create("dataset_map_test.h5", file::AccessFlags::Truncate);
+    THEN("mapping a chunked dataset fails") {
+      node::ChunkedDataset dataset(f.root(), "chunked", datatype::create<int>(),
+                                   dataspace::Simple{{12, 7}}, {4, 7});
+      dataset.write(data);
+      REQUIRE_THROWS_AS(dataset.map(), std::runtime_error);
+    }
+    THEN("mapping a dataset without storage fails") {
+      node::Dataset dataset(f.root(), "empty", datatype::create<int>(),
+                            dataspace::Simple{{12, 7}});
+      REQUIRE_THROWS_AS(dataset.map(), std::runtime_error);
+    }
+    THEN("mapping a variable length string dataset fails") {
+      node::Dataset dataset(f.root(), "strings", datatype::create<std::string>(),
+                            dataspace::Simple{{3}});
+      REQUIRE_THROWS_AS(dataset.map(), std::runtime_error);
+    }
+  }
+
+  GIVEN("a file in memory") {
+    property::FileAccessList fapl;
+    fapl.driver(file::MemoryDriver());
+    auto f = file::create("dataset_map_memory.h5", file::AccessFlags::Truncate,
+                          property::FileCreationList(), fapl);
+    node::Dataset dataset(f.root(), "data", datatype::create<int>(),
+                          dataspace::Simple{{12, 7}});
+    dataset.write(data);
+    THEN("the dataset cannot be mapped") {
+      REQUIRE_THROWS_AS(dataset.map(), std::runtime_error);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,143 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+#include <numeric>
+
+using namespace hdf5;
+
+namespace {
+const hsize_t nx = 16;
+const hsize_t nframes = 100;
+
+node::Dataset create_dataset(const node::Group& base, const std::string& name) {
+  dataspace::Simple space{{0, nx}, {dataspace::Simple::unlimited, nx}};
+  return node::ChunkedDataset(base, name, datatype::create<int>(), space,
+                              {64, nx});
+}
+}  // namespace
+
+SCENARIO("prepared dataset IO") {
+  auto f = file::create("dataset_prepared_io_test.h5", file::AccessFlags::Truncate);
+  std::vector<int> frame(nx);
+
+  GIVEN("an extensible dataset") {
+    auto dataset = create_dataset(f.root(), "data");
+
+    WHEN("appending frames with a prepared write") {
+      auto writer = dataset.prepare_write<std::vector<int>>(
+          dataspace::Hyperslab{{0, 0}, {1, nx}});
+      for (hsize_t index = 0; index < nframes; ++index) {
+        std::iota(frame.begin(), frame.end(), static_cast<int>(index * nx));
+        writer.append(frame);
+      }
+      THEN("the dataset has grown by one frame per append") {
+        REQUIRE(dataspace::Simple(dataset.dataspace()).current_dimensions() ==
+                Dimensions{nframes, nx});
+        REQUIRE(writer.selection().offset() == Dimensions{nframes, 0});
+      }
+      AND_THEN("the frames can be read with a prepared read") {
+        auto reader = dataset.prepare_read<std::vector<int>>(
+            dataspace::Hyperslab{{0, 0}, {1, nx}});
+        std::vector<int> expected(nx);
+        for (hsize_t index = 0; index < nframes; ++index) {
+          reader.execute(frame);
+          reader.advance();
+          std::iota(expected.begin(), expected.end(), static_cast<int>(index * nx));
+          REQUIRE(frame == expected);
+        }
+      }
+      AND_THEN("the entire dataset can be read at once") {
+        std::vector<int> all(nframes * nx);
+        dataset.prepare_read<std::vector<int>>().execute(all);
+        std::vector<int> expected(nframes * nx);
+        std::iota(expected.begin(), expected.end(), 0);
+        REQUIRE(all == expected);
+      }
+    }
+
+    WHEN("writing repeatedly to the same selection") {
+      dataset.extent(0, 2);
+      auto writer = dataset.prepare_write<std::vector<int>>(
+          dataspace::Hyperslab{{1, 0}, {1, nx}});
+      std::fill(frame.begin(), frame.end(), 1);
+      writer.execute(frame);
+      std::fill(frame.begin(), frame.end(), 2);
+      writer.execute(frame);
+      THEN("the last write wins") {
+        std::vector<int> read(nx);
+        dataset.read(read, dataspace::Hyperslab{{1, 0}, {1, nx}});
+        REQUIRE(read == frame);
+      }
+    }
+
+    THEN("invalid selections and dimensions are rejected") {
+      REQUIRE_THROWS_AS(dataset.prepare_write<std::vector<int>>(
+                            dataspace::Hyperslab{{0}, {1}}),
+                        std::runtime_error);
+      auto writer = dataset.prepare_write<std::vector<int>>(
+          dataspace::Hyperslab{{0, 0}, {1, nx}});
+      REQUIRE_THROWS_AS(writer.append(frame, 2), std::runtime_error);
+    }
+  }
+
+  GIVEN("a dataset of fixed size") {
+    node::Dataset dataset(f.root(), "fixed", datatype::create<int>(),
+                          dataspace::Simple{{4, nx}});
+    auto writer = dataset.prepare_write<std::vector<int>>(
+        dataspace::Hyperslab{{0, 0}, {1, nx}});
+    THEN("appending beyond the maximum extent fails") {
+      for (hsize_t index = 0; index < 4; ++index) writer.append(frame);
+      REQUIRE_THROWS_AS(writer.append(frame), std::runtime_error);
+    }
+  }
+}
+
+SCENARIO("prepared dataset IO performance") {
+  auto f = file::create("dataset_prepared_io_speed.h5", file::AccessFlags::Truncate);
+  std::vector<int> frame(nx, 1);
+
+  BENCHMARK("appending frames with extent, hyperslab and write") {
+    auto dataset = create_dataset(f.root(), "naive");
+    dataspace::Hyperslab selection{{0, 0}, {1, nx}};
+    for (hsize_t index = 0; index < nframes; ++index) {
+      dataset.extent(0, 1);
+      selection.offset(0, index);
+      dataset.write(frame, selection);
+    }
+    f.root().remove("naive");
+  };
+
+  BENCHMARK("appending frames with a prepared write") {
+    auto dataset = create_dataset(f.root(), "prepared");
+    auto writer = dataset.prepare_write<std::vector<int>>(
+        dataspace::Hyperslab{{0, 0}, {1, nx}});
+    for (hsize_t index = 0; index < nframes; ++index) writer.append(frame);
+    f.root().remove("prepared");
+  };
+}
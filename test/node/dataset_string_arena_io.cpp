@@ -0,0 +1,108 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/contrib/stl/string.hpp>
+#include <h5cpp/hdf5.hpp>
+#include <string>
+#include <string_view>
+
+using namespace hdf5;
+
+SCENARIO("reading variable length strings into an arena") {
+  auto f = file::create("DatasetStringArenaIO.h5", file::AccessFlags::Truncate);
+  std::vector<std::string> strings{"hello", "", "world", "this", "is", "an",
+                                   "arbitrary", "text"};
+  StringArena arena(16);
+
+  GIVEN("a variable length string dataset") {
+    node::Dataset dataset(f.root(), "strings", datatype::create<std::string>(),
+                          dataspace::Simple{{strings.size()}});
+    dataset.write(strings);
+
+    THEN("all strings can be read as views") {
+      std::vector<std::string_view> views;
+      dataset.read(views, arena);
+      REQUIRE(views.size() == strings.size());
+      for (size_t index = 0; index < strings.size(); ++index)
+        REQUIRE(views[index] == strings[index]);
+      REQUIRE(arena.size() > 0);
+      REQUIRE(arena.capacity() >= arena.size());
+
+      AND_THEN("a selection can be read into the same arena") {
+        std::vector<std::string_view> selected;
+        dataset.read(selected, arena, dataspace::Hyperslab{{2}, {3}});
+        REQUIRE(selected == std::vector<std::string_view>{"world", "this", "is"});
+        REQUIRE(views[0] == "hello");
+      }
+    }
+  }
+
+  GIVEN("a scalar variable length string dataset") {
+    node::Dataset dataset(f.root(), "scalar", datatype::create<std::string>(),
+                          dataspace::Scalar());
+    dataset.write(std::string("a single string"));
+    THEN("the string can be read as a view") {
+      std::vector<std::string_view> views;
+      dataset.read(views, arena);
+      REQUIRE(views == std::vector<std::string_view>{"a single string"});
+    }
+  }
+
+  GIVEN("a fixed length string dataset") {
+    auto type = datatype::String::fixed(10);
+    node::Dataset dataset(f.root(), "fixed", type, dataspace::Simple{{2}});
+    THEN("reading views fails") {
+      std::vector<std::string_view> views;
+      REQUIRE_THROWS_AS(dataset.read(views, arena), std::runtime_error);
+    }
+  }
+}
+
+SCENARIO("variable length string read performance") {
+  auto f = file::create("DatasetStringArenaSpeed.h5", file::AccessFlags::Truncate);
+  const size_t size = 100000;
+  std::vector<std::string> strings(size);
+  for (size_t index = 0; index < size; ++index)
+    strings[index] = "log message number " + std::to_string(index);
+  node::Dataset dataset(f.root(), "strings", datatype::create<std::string>(),
+                        dataspace::Simple{{size}});
+  dataset.write(strings);
+
+  BENCHMARK("reading 100000 strings as std::string") {
+    std::vector<std::string> read(size);
+    dataset.read(read);
+    return read.size();
+  };
+
+  BENCHMARK("reading 100000 strings into an arena") {
+    StringArena arena;
+    std::vector<std::string_view> read;
+    dataset.read(read, arena);
+    return read.size();
+  };
+}
@@ -0,0 +1,98 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//               2020 Eugen Wintersberger <eugen.wintersberger@gmail.com>
+//
+// This file is part of h5pp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+
+using namespace hdf5;
+
+SCENARIO("looking up nodes without exceptions") {
+  auto f = file::create("find_node_test.h5", file::AccessFlags::Truncate);
+  auto r = f.root();
+  auto sample = r.create_group("entry").create_group("sample");
+  sample.create_dataset("temperature", datatype::create<double>(),
+                        dataspace::Scalar());
+  node::link(Path("/entry/sample"), r, "soft");
+  node::link(Path("/entry/missing"), r, "dangling");
+
+  THEN("the root and empty paths refer to groups") {
+    REQUIRE(node::find_type(r, Path("/")) == node::Type::Group);
+    REQUIRE(node::find_type(sample, Path()) == node::Type::Group);
+  }
+
+  THEN("existing nodes are found") {
+    REQUIRE(node::find_type(r, "/entry/sample") == node::Type::Group);
+    REQUIRE(node::find_type(r, "entry/sample/temperature") ==
+            node::Type::Dataset);
+    REQUIRE(node::find_type(sample, "temperature") == node::Type::Dataset);
+    REQUIRE(node::find_type(sample, "/entry") == node::Type::Group);
+    REQUIRE(node::find_type(r, "soft/temperature") == node::Type::Dataset);
+  }
+
+  THEN("missing nodes are not found") {
+    REQUIRE_FALSE(node::find_type(r, "/entry/instrument"));
+    REQUIRE_FALSE(node::find_type(r, "/entry/instrument/detector/data"));
+    REQUIRE_FALSE(node::find_type(r, "/entry/sample/temperature/value"));
+    REQUIRE_FALSE(node::find_type(r, "dangling"));
+    REQUIRE_FALSE(node::find_type(r, "dangling/data"));
+  }
+
+  THEN("only existing nodes are returned") {
+    auto node = node::find_node(r, "/entry/sample/temperature");
+    REQUIRE(node);
+    REQUIRE(node->type() == node::Type::Dataset);
+    REQUIRE(node->link().path() == Path("/entry/sample/temperature"));
+    REQUIRE_FALSE(node::find_node(r, "/entry/sample/pressure"));
+  }
+
+  THEN("has_group and has_dataset report the node type") {
+    REQUIRE(r.has_group("entry/sample"));
+    REQUIRE_FALSE(r.has_group("entry/sample/temperature"));
+    REQUIRE(r.has_dataset("entry/sample/temperature"));
+    REQUIRE_FALSE(r.has_dataset("entry/sample"));
+    REQUIRE_FALSE(r.has_dataset("entry/instrument/data"));
+  }
+}
+
+SCENARIO("performance of probing missing nodes") {
+  auto f = file::create("find_node_speed.h5", file::AccessFlags::Truncate);
+  auto r = f.root();
+  r.create_group("entry").create_group("sample");
+  Path missing("/entry/sample/environment/pressure");
+
+  BENCHMARK("probing a missing node with get_node") {
+    try {
+      return node::get_node(r, missing).type();
+    } catch (...) {
+      return node::Type::Unknown;
+    }
+  };
+  BENCHMARK("probing a missing node with find_type") {
+    return node::find_type(r, missing).value_or(node::Type::Unknown);
+  };
+}
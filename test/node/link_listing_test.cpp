@@ -0,0 +1,175 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//               2020 Eugen Wintersberger <eugen.wintersberger@gmail.com>
+//
+// This file is part of h5pp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#include <algorithm>
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+#include <string>
+#include <vector>
+
+using namespace hdf5;
+
+SCENARIO("listing the links of a group in a single pass") {
+  property::FileCreationList fcpl;
+  property::FileAccessList fapl;
+  fapl.library_version_bounds(property::LibVersion::Latest,
+                              property::LibVersion::Latest);
+  fcpl.link_creation_order(property::CreationOrder().enable_indexed());
+  auto f = file::create("link_listing_test.h5", file::AccessFlags::Truncate,
+                        fcpl, fapl);
+  auto r = f.root();
+  auto g = r.create_group("group");
+  auto d = r.create_dataset("data", datatype::create<int>(),
+                            dataspace::Scalar());
+  node::link(g, r, "soft");
+  node::link("other.h5", "/data", r, "external");
+
+  GIVEN("the listing in creation order") {
+    r.iterator_config().index(IterationIndex::CreationOrder);
+    auto listing = r.links.list();
+    THEN("the listing has one entry per link") {
+      REQUIRE(listing.size() == r.links.size());
+    }
+    THEN("the entries follow the iterator configuration") {
+      REQUIRE(listing[0].name == "group");
+      REQUIRE(listing[1].name == "data");
+      REQUIRE(listing[2].name == "soft");
+      REQUIRE(listing[3].name == "external");
+    }
+    THEN("the link types are reported") {
+      REQUIRE(listing[0].type == node::LinkType::Hard);
+      REQUIRE(listing[1].type == node::LinkType::Hard);
+      REQUIRE(listing[2].type == node::LinkType::Soft);
+      REQUIRE(listing[3].type == node::LinkType::External);
+    }
+    THEN("only hard links carry an address") {
+      REQUIRE(listing[0].address != HADDR_UNDEF);
+      REQUIRE(listing[1].address != HADDR_UNDEF);
+      REQUIRE(listing[0].address != listing[1].address);
+      REQUIRE(listing[2].address == HADDR_UNDEF);
+      REQUIRE(listing[3].address == HADDR_UNDEF);
+    }
+  }
+
+  GIVEN("the listing in decreasing name order") {
+    r.iterator_config().index(IterationIndex::Name);
+    r.iterator_config().order(IterationOrder::Decreasing);
+    auto listing = r.links.list();
+    THEN("the names are sorted in decreasing order") {
+      std::vector<std::string> names;
+      std::transform(listing.begin(), listing.end(), std::back_inserter(names),
+                     [](const node::LinkEntry& e) { return e.name; });
+      REQUIRE(names == std::vector<std::string>{"soft", "group", "external",
+                                                "data"});
+    }
+    THEN("the listing matches index based access") {
+      for (size_t index = 0; index < listing.size(); ++index) {
+        REQUIRE(listing[index].name == r.links[index].path().name());
+      }
+    }
+  }
+
+  GIVEN("a link with a name longer than the initial name buffer") {
+    std::string name(300, 'x');
+    r.create_group(name);
+    r.iterator_config().index(IterationIndex::CreationOrder);
+    THEN("index based access returns the full name") {
+      REQUIRE(r.links[4].path().name() == name);
+    }
+    THEN("the listing contains the full name") {
+      REQUIRE(r.links.list()[4].name == name);
+    }
+  }
+
+  GIVEN("an empty group") {
+    THEN("the listing is empty") {
+      REQUIRE(g.links.list().empty());
+      REQUIRE(g.links.begin() == g.links.end());
+      REQUIRE(g.nodes.begin() == g.nodes.end());
+    }
+  }
+
+  GIVEN("node iteration over hard and soft links") {
+    r.iterator_config().index(IterationIndex::CreationOrder);
+    THEN("the nodes are opened with the link path") {
+      auto iter = r.nodes.begin();
+      REQUIRE(iter->type() == node::Type::Group);
+      REQUIRE(iter->link().path() == "/group");
+      ++iter;
+      REQUIRE(iter->type() == node::Type::Dataset);
+      REQUIRE(iter->link().path() == "/data");
+      REQUIRE(iter->id() == d.id());
+      ++iter;
+      REQUIRE(iter->type() == node::Type::Group);
+      REQUIRE(iter->link().path() == "/soft");
+      REQUIRE(iter->id() == g.id());
+    }
+  }
+}
+
+SCENARIO("listing a large flat group", "[benchmark]") {
+  // the default file format stores the links in a symbol table where each
+  // index based lookup has to walk the table
+  auto f = file::create("link_listing_benchmark.h5",
+                        file::AccessFlags::Truncate);
+  auto r = f.root();
+  auto g = r.create_group("flat");
+  const size_t count = 2000;
+  for (size_t index = 0; index < count; ++index) {
+    g.create_group("group_" + std::to_string(index));
+  }
+
+  std::vector<std::string> names;
+  names.reserve(count);
+
+  BENCHMARK("listing links by index") {
+    names.clear();
+    for (size_t index = 0; index < count; ++index) {
+      names.push_back(g.links[index].path().name());
+    }
+    return names.size();
+  };
+
+  BENCHMARK("listing links with a single iteration") {
+    names.clear();
+    for (const auto& entry : g.links.list()) {
+      names.push_back(entry.name);
+    }
+    return names.size();
+  };
+
+  BENCHMARK("iterating over links") {
+    names.clear();
+    for (const auto& link : g.links) {
+      names.push_back(link.path().name());
+    }
+    return names.size();
+  };
+
+  REQUIRE(names.size() == count);
+}
@@ -0,0 +1,175 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//               2020 Eugen Wintersberger <eugen.wintersberger@gmail.com>
+//
+// This file is part of h5pp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+
+using namespace hdf5;
+
+SCENARIO("caching path lookups") {
+  auto f = file::create("path_cache_test.h5", file::AccessFlags::Truncate);
+  auto r = f.root();
+  auto data = r.create_group("entry").create_group("instrument")
+                  .create_group("data");
+  data.create_dataset("frames", datatype::create<int>(),
+                      dataspace::Simple({4}));
+  node::link(Path("/entry/instrument"), r, "soft");
+
+  auto &cache = node::PathCache::instance();
+  cache.clear();
+
+  GIVEN("a file without caching") {
+    r.get_dataset("/entry/instrument/data/frames");
+    THEN("lookups are not counted") {
+      REQUIRE_FALSE(cache.is_enabled(f));
+      REQUIRE(cache.hits() == 0ul);
+      REQUIRE(cache.misses() == 0ul);
+      REQUIRE(cache.size() == 0ul);
+    }
+  }
+
+  GIVEN("a file with caching enabled") {
+    cache.enable(f);
+    REQUIRE(cache.is_enabled(f));
+    auto first = r.get_dataset("/entry/instrument/data/frames");
+
+    THEN("the first lookup is a miss") {
+      REQUIRE(cache.misses() == 1ul);
+      REQUIRE(cache.hits() == 0ul);
+      REQUIRE(cache.size() == 1ul);
+    }
+
+    WHEN("looking up the same path again") {
+      auto second = r.get_dataset("/entry/instrument/data/frames");
+      THEN("the object is taken from the cache") {
+        REQUIRE(cache.hits() == 1ul);
+        REQUIRE(second.id() == first.id());
+        REQUIRE(second.link().path() == Path("/entry/instrument/data/frames"));
+        REQUIRE(second.dataspace().size() == 4);
+      }
+    }
+
+    WHEN("looking up the path relative to a group") {
+      auto instrument = r.get_group("entry/instrument");
+      auto second = instrument.get_dataset("data/frames");
+      THEN("the object is taken from the cache") {
+        REQUIRE(cache.hits() == 1ul);
+        REQUIRE(second.id() == first.id());
+      }
+    }
+
+    WHEN("looking up the object via a soft link") {
+      auto soft = r.get_dataset("/soft/data/frames");
+      THEN("the path is cached separately") {
+        REQUIRE(soft.id() == first.id());
+        REQUIRE(soft.link().path() == Path("/soft/data/frames"));
+        REQUIRE(cache.size() == 2ul);
+      }
+    }
+
+    WHEN("removing the object") {
+      r.get_dataset("/soft/data/frames");
+      node::remove(r, "entry/instrument/data/frames");
+      THEN("the entries of the file are invalidated") {
+        REQUIRE(cache.size() == 0ul);
+        REQUIRE_FALSE(r.has_dataset("/entry/instrument/data/frames"));
+        REQUIRE_FALSE(r.has_dataset("/soft/data/frames"));
+      }
+    }
+
+    WHEN("moving a group") {
+      node::move(data, r, "moved");
+      THEN("the object is found under the new path only") {
+        REQUIRE(cache.size() == 0ul);
+        REQUIRE_FALSE(r.has_dataset("/entry/instrument/data/frames"));
+        REQUIRE(r.get_dataset("/moved/frames").id() == first.id());
+      }
+    }
+
+    WHEN("creating a link below a cached path") {
+      node::link(Path("/entry"), data, "up");
+      THEN("the entries below the new link are invalidated") {
+        REQUIRE(cache.size() == 1ul);
+        r.get_group("/entry/instrument/data/up");
+        REQUIRE(cache.size() == 2ul);
+        node::link(Path("/entry"), r, "entry_link");
+        REQUIRE(cache.size() == 2ul);
+        cache.invalidate(f, Path("/entry/instrument/data"));
+        REQUIRE(cache.size() == 0ul);
+      }
+    }
+
+    WHEN("disabling the cache") {
+      cache.disable(f);
+      THEN("all entries are removed") {
+        REQUIRE_FALSE(cache.is_enabled(f));
+        REQUIRE(cache.size() == 0ul);
+        REQUIRE_FALSE(cache.is_active());
+      }
+    }
+  }
+
+  GIVEN("an object in another file") {
+    {
+      auto other = file::create("path_cache_test_external.h5",
+                                file::AccessFlags::Truncate);
+      other.root().create_group("target");
+    }
+    node::link("path_cache_test_external.h5", "/target", r, "external");
+    cache.enable(f);
+    auto target = r.get_group("/external");
+    THEN("the object is not cached") {
+      REQUIRE(cache.misses() == 1ul);
+      REQUIRE(cache.size() == 0ul);
+    }
+  }
+
+  cache.clear();
+}
+
+SCENARIO("looking up deep paths repeatedly", "[benchmark]") {
+  auto f = file::create("path_cache_benchmark.h5", file::AccessFlags::Truncate);
+  auto r = f.root();
+  auto g = r;
+  for (size_t depth = 0; depth < 8; ++depth) {
+    g = g.create_group("level_" + std::to_string(depth));
+  }
+  g.create_dataset("data", datatype::create<int>(), dataspace::Scalar());
+  Path path("/level_0/level_1/level_2/level_3/level_4/level_5/level_6/"
+            "level_7/data");
+
+  auto &cache = node::PathCache::instance();
+  cache.clear();
+
+  BENCHMARK("lookup without cache") { return r.get_dataset(path).is_valid(); };
+
+  cache.enable(f);
+  BENCHMARK("lookup with cache") { return r.get_dataset(path).is_valid(); };
+
+  cache.clear();
+}
@@ -0,0 +1,197 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//               2020 Eugen Wintersberger <eugen.wintersberger@gmail.com>
+//
+// This file is part of h5pp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#include <algorithm>
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+#include <string>
+#include <vector>
+
+using namespace hdf5;
+
+namespace {
+
+const node::CatalogueEntry &find(const node::Catalogue &catalogue,
+                                 const std::string &path) {
+  auto entry = std::find_if(
+      catalogue.entries.begin(), catalogue.entries.end(),
+      [&path](const node::CatalogueEntry &e) { return e.path == path; });
+  REQUIRE(entry != catalogue.entries.end());
+  return *entry;
+}
+
+std::vector<std::string> paths(const node::Catalogue &catalogue) {
+  std::vector<std::string> result;
+  for (const auto &entry : catalogue.entries) result.push_back(entry.path);
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+void create_tree(const fs::path &path) {
+  auto f = file::create(path, file::AccessFlags::Truncate);
+  auto r = f.root();
+  auto entry = r.create_group("entry");
+  auto data = entry.create_group("data");
+  auto frames = data.create_dataset(
+      "frames", datatype::create<std::uint16_t>(),
+      dataspace::Simple({4, 16, 32}));
+  frames.attributes.create<std::string>("units").write("counts");
+  frames.attributes.create<std::string>("long_name").write("frames");
+  entry.create_dataset("title", datatype::create<std::string>(),
+                       dataspace::Scalar());
+  r.create_group("empty");
+  r.create_dataset("scale", datatype::create<double>(),
+                   dataspace::Simple({10}));
+  node::link(frames, r, "frames_link");
+  node::link(Path("/entry/data"), r, "soft");
+}
+
+}  // namespace
+
+SCENARIO("scanning a file tree into a catalogue") {
+  create_tree("scan_test.h5");
+  auto r = file::open("scan_test.h5").root();
+
+  GIVEN("a scan of the root group") {
+    auto catalogue = node::scan(r);
+    THEN("the catalogue refers to the file") {
+      REQUIRE(catalogue.files.size() == 1ul);
+      REQUIRE(catalogue.files[0].filename() == "scan_test.h5");
+    }
+    THEN("every object is recorded once") {
+      REQUIRE(paths(catalogue) ==
+              std::vector<std::string>{"/empty", "/entry", "/entry/data",
+                                       "/entry/data/frames", "/entry/title",
+                                       "/scale"});
+    }
+    THEN("the object header information is recorded") {
+      auto frames = find(catalogue, "/entry/data/frames");
+      REQUIRE(frames.type == node::Type::Dataset);
+      REQUIRE(frames.attributes == 2ul);
+      REQUIRE(frames.address != HADDR_UNDEF);
+      REQUIRE(frames.file == 0ul);
+      auto data = find(catalogue, "/entry/data");
+      REQUIRE(data.type == node::Type::Group);
+      REQUIRE(data.attributes == 0ul);
+      REQUIRE(data.shape.empty());
+      REQUIRE(data.datatype_class == datatype::Class::None);
+    }
+    THEN("the dataset details are recorded") {
+      auto frames = find(catalogue, "/entry/data/frames");
+      REQUIRE(frames.shape == Dimensions{4, 16, 32});
+      REQUIRE(frames.datatype_class == datatype::Class::Integer);
+      auto title = find(catalogue, "/entry/title");
+      REQUIRE(title.shape.empty());
+      REQUIRE(title.datatype_class == datatype::Class::String);
+      auto scale = find(catalogue, "/scale");
+      REQUIRE(scale.shape == Dimensions{10});
+      REQUIRE(scale.datatype_class == datatype::Class::Float);
+    }
+  }
+
+  GIVEN("a scan without dataset details on a single thread") {
+    node::ScanOptions options;
+    options.threads = 1;
+    options.dataset_details = false;
+    auto catalogue = node::scan(r, options);
+    THEN("only the object header information is recorded") {
+      REQUIRE(catalogue.entries.size() == 6ul);
+      auto frames = find(catalogue, "/entry/data/frames");
+      REQUIRE(frames.shape.empty());
+      REQUIRE(frames.datatype_class == datatype::Class::None);
+      REQUIRE(frames.attributes == 2ul);
+    }
+  }
+
+  GIVEN("a scan of a subgroup") {
+    auto catalogue = node::scan(r.get_group("entry"));
+    THEN("only the objects below the group are recorded") {
+      REQUIRE(paths(catalogue) ==
+              std::vector<std::string>{"/entry/data", "/entry/data/frames",
+                                       "/entry/title"});
+    }
+  }
+
+  GIVEN("a scan of an empty group") {
+    THEN("the catalogue is empty") {
+      REQUIRE(node::scan(r.get_group("empty")).entries.empty());
+    }
+  }
+}
+
+SCENARIO("scanning several files") {
+  std::vector<fs::path> files{"scan_test_1.h5", "scan_test_2.h5",
+                              "scan_test_3.h5"};
+  for (const auto &path : files) create_tree(path);
+
+  auto catalogue = node::scan(files);
+  THEN("the entries of all files are recorded") {
+    REQUIRE(catalogue.files == files);
+    REQUIRE(catalogue.entries.size() == 18ul);
+  }
+  THEN("the entries of each file are stored consecutively") {
+    for (size_t index = 0; index < catalogue.entries.size(); ++index) {
+      REQUIRE(catalogue.entries[index].file == index / 6);
+    }
+  }
+
+  GIVEN("a file which does not exist") {
+    files.push_back("scan_test_missing.h5");
+    THEN("the scan fails") {
+      REQUIRE_THROWS_AS(node::scan(files), std::runtime_error);
+    }
+  }
+}
+
+SCENARIO("cataloguing a large tree", "[benchmark]") {
+  auto f = file::create("scan_benchmark.h5", file::AccessFlags::Truncate);
+  auto r = f.root();
+  for (size_t g = 0; g < 20; ++g) {
+    auto group = r.create_group("group_" + std::to_string(g));
+    for (size_t d = 0; d < 25; ++d) {
+      group.create_dataset("data_" + std::to_string(d),
+                           datatype::create<int>(), dataspace::Simple({8}));
+    }
+  }
+
+  BENCHMARK("recursive node iteration") {
+    size_t count = 0;
+    std::for_each(node::RecursiveNodeIterator::begin(r),
+                  node::RecursiveNodeIterator::end(r),
+                  [&count](const node::Node &) { ++count; });
+    return count;
+  };
+
+  BENCHMARK("scan") { return node::scan(r).entries.size(); };
+
+  BENCHMARK("scan without dataset details") {
+    node::ScanOptions options;
+    options.dataset_details = false;
+    return node::scan(r, options).entries.size();
+  };
+}
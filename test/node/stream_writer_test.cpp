@@ -0,0 +1,159 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+#include <numeric>
+
+using namespace hdf5;
+
+namespace {
+const hsize_t nx = 32;
+const hsize_t nframes = 1000;
+
+node::Dataset create_dataset(const node::Group& base, const std::string& name,
+                             hsize_t max_frames = dataspace::Simple::unlimited) {
+  dataspace::Simple space{{0, nx}, {max_frames, nx}};
+  return node::ChunkedDataset(base, name, datatype::create<int>(), space,
+                              {64, nx});
+}
+
+Dimensions dimensions(const node::Dataset& dataset) {
+  return dataspace::Simple(dataset.dataspace()).current_dimensions();
+}
+}  // namespace
+
+SCENARIO("streaming frames to a dataset") {
+  auto f = file::create("stream_writer_test.h5", file::AccessFlags::Truncate);
+  std::vector<int> frame(nx);
+
+  GIVEN("an extensible dataset") {
+    auto dataset = create_dataset(f.root(), "data");
+
+    WHEN("streaming frames one by one") {
+      node::StreamWriter<int> writer(dataset);
+      REQUIRE(writer.frame_size() == nx);
+      REQUIRE(writer.frames_per_flush() == 64);
+      for (hsize_t index = 0; index < nframes; ++index) {
+        std::iota(frame.begin(), frame.end(), static_cast<int>(index * nx));
+        writer.write(frame);
+      }
+      THEN("the extent has grown beyond the number of frames") {
+        REQUIRE(writer.frames() == nframes);
+        REQUIRE(dimensions(dataset)[0] > nframes - writer.buffered());
+        REQUIRE(dimensions(dataset)[0] % 64 == 0);
+      }
+      AND_WHEN("closing the writer") {
+        writer.close();
+        THEN("the extent matches the number of frames") {
+          REQUIRE(writer.is_closed());
+          REQUIRE(dimensions(dataset) == Dimensions{nframes, nx});
+          std::vector<int> data(nframes * nx), expected(nframes * nx);
+          std::iota(expected.begin(), expected.end(), 0);
+          dataset.read(data);
+          REQUIRE(data == expected);
+          REQUIRE_THROWS_AS(writer.write(frame), std::runtime_error);
+          REQUIRE_NOTHROW(writer.close());
+        }
+      }
+    }
+
+    WHEN("streaming several frames at once") {
+      std::vector<int> frames(100 * nx);
+      std::iota(frames.begin(), frames.end(), 0);
+      {
+        node::StreamWriter<int> writer(dataset, 100);
+        REQUIRE(writer.frames_per_flush() == 128);
+        writer.write(frames);
+        writer.write(frames.data(), 3);
+        REQUIRE_THROWS_AS(writer.write(std::vector<int>(nx + 1)),
+                          std::runtime_error);
+      }
+      THEN("the destructor closes the writer") {
+        REQUIRE(dimensions(dataset) == Dimensions{103, nx});
+        std::vector<int> data(nx);
+        dataset.read(data, dataspace::Hyperslab{{102, 0}, {1, nx}});
+        REQUIRE(data[0] == static_cast<int>(2 * nx));
+      }
+      AND_THEN("a new writer appends to the existing data") {
+        node::StreamWriter<int> writer(dataset);
+        REQUIRE(writer.frames() == 103);
+        writer.write(frames.data(), 1);
+        writer.close();
+        REQUIRE(dimensions(dataset) == Dimensions{104, nx});
+      }
+    }
+  }
+
+  GIVEN("a dataset with a maximum extent") {
+    auto dataset = create_dataset(f.root(), "limited", 100);
+    node::StreamWriter<int> writer(dataset);
+    THEN("growing is capped and exceeding the maximum fails") {
+      std::vector<int> frames(100 * nx);
+      writer.write(frames);
+      writer.flush();
+      REQUIRE(dimensions(dataset)[0] == 100);
+      writer.write(frame);
+      REQUIRE_THROWS_AS(writer.flush(), std::runtime_error);
+    }
+  }
+
+  GIVEN("a contiguous dataset") {
+    node::Dataset dataset(f.root(), "contiguous", datatype::create<int>(),
+                          dataspace::Simple{{4, nx}});
+    THEN("a stream writer cannot be constructed") {
+      REQUIRE_THROWS_AS(node::StreamWriter<int>(dataset), std::runtime_error);
+    }
+  }
+}
+
+SCENARIO("streaming frames performance") {
+  auto f = file::create("stream_writer_speed.h5", file::AccessFlags::Truncate);
+  std::vector<int> frame(nx, 1);
+
+  BENCHMARK("appending 1000 frames with extent, hyperslab and write") {
+    auto dataset = create_dataset(f.root(), "naive");
+    dataspace::Hyperslab selection{{0, 0}, {1, nx}};
+    for (hsize_t index = 0; index < nframes; ++index) {
+      dataset.extent(0, 1);
+      selection.offset(0, index);
+      dataset.write(frame, selection);
+    }
+    f.root().remove("naive");
+    return nframes;
+  };
+
+  BENCHMARK("appending 1000 frames with a stream writer") {
+    auto dataset = create_dataset(f.root(), "stream");
+    {
+      node::StreamWriter<int> writer(dataset);
+      for (hsize_t index = 0; index < nframes; ++index) writer.write(frame);
+    }
+    f.root().remove("stream");
+    return nframes;
+  };
+}
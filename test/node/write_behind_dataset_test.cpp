@@ -0,0 +1,97 @@
+//
+// (c) Copyright 2017 DESY,ESS
+//
+// This file is part of h5cpp.
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty ofMERCHANTABILITY
+// or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor
+// Boston, MA  02110-1301 USA
+// ===========================================================================
+//
+// Created on: Oct 16, 2026
+//
+#ifdef H5CPP_CATCH2_V2
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_all.hpp>
+#endif
+#include <h5cpp/hdf5.hpp>
+#include <numeric>
+
+using namespace hdf5;
+
+namespace {
+const hsize_t nx = 1024;
+const hsize_t nframes = 64;
+}  // namespace
+
+SCENARIO("write-behind buffering of a dataset") {
+  auto f = file::create("write_behind_dataset_test.h5", file::AccessFlags::Truncate);
+  node::Dataset dataset(f.root(), "data", datatype::create<int>(),
+                        dataspace::Simple{{nframes, nx}});
+  std::vector<int> frame(nx);
+
+  GIVEN("a budget for four frames") {
+    node::WriteBehindDataset buffered(dataset, 4 * nx * sizeof(int));
+    REQUIRE(buffered.budget() == 4 * nx * sizeof(int));
+
+    WHEN("writing all frames") {
+      for (hsize_t index = 0; index < nframes; ++index) {
+        std::iota(frame.begin(), frame.end(), static_cast<int>(index * nx));
+        buffered.write(frame, dataspace::Hyperslab{{index, 0}, {1, nx}});
+      }
+      buffered.flush(file::Scope::Global);
+
+      THEN("the data arrives in the dataset") {
+        std::vector<int> data(nframes * nx), expected(nframes * nx);
+        std::iota(expected.begin(), expected.end(), 0);
+        dataset.read(data);
+        REQUIRE(data == expected);
+      }
+      AND_THEN("the metrics reflect the drained writes") {
+        auto metrics = buffered.metrics();
+        REQUIRE(metrics.drained == nframes);
+        REQUIRE(metrics.queue_depth == 0);
+        REQUIRE(metrics.pending_bytes == 0);
+        REQUIRE(metrics.max_queue_depth >= 1);
+        REQUIRE(metrics.max_queue_depth <= 4);
+        REQUIRE(metrics.max_pending_bytes <= buffered.budget());
+        REQUIRE(metrics.max_drain_latency >= metrics.mean_drain_latency);
+        REQUIRE(metrics.mean_drain_latency.count() > 0);
+      }
+    }
+
+    THEN("writes must match the selection and fit into the budget") {
+      REQUIRE_THROWS_AS(
+          buffered.write(frame, dataspace::Hyperslab{{0, 0}, {2, nx}}),
+          std::runtime_error);
+      std::vector<int> block(8 * nx);
+      REQUIRE_THROWS_AS(
+          buffered.write(block, dataspace::Hyperslab{{0, 0}, {8, nx}}),
+          std::runtime_error);
+    }
+
+    THEN("a failing write is reported by flush") {
+      buffered.write(frame, dataspace::Hyperslab{{nframes, 0}, {1, nx}});
+      REQUIRE_THROWS_AS(buffered.flush(), std::runtime_error);
+      AND_THEN("the error is reported only once") {
+        REQUIRE_NOTHROW(buffered.flush());
+      }
+    }
+  }
+
+  THEN("a budget of 0 is rejected") {
+    REQUIRE_THROWS_AS(node::WriteBehindDataset(dataset, 0), std::runtime_error);
+  }
+}
@@ -227,3 +227,126 @@ SCENARIO("setting the file driver on a file access property list") {
     }
   }
 }
+
+SCENARIO("configuring the metadata cache on a file access property list") {
+  GIVEN("a default constructed list") {
+    pl::FileAccessList fapl;
+    auto config = fapl.metadata_cache_config();
+    THEN("the configuration is the library default") {
+      pl::MetadataCacheConfig defaults;
+      REQUIRE(config.initial_size() == defaults.initial_size());
+      REQUIRE(config.max_size() == defaults.max_size());
+      REQUIRE(config.adaptive());
+      REQUIRE(config.evictions_enabled());
+    }
+    WHEN("setting a fixed size cache") {
+      config.initial_size(8 * 1024 * 1024);
+      config.min_size(1024 * 1024);
+      config.max_size(32 * 1024 * 1024);
+      config.min_clean_fraction(0.5);
+      config.adaptive(false);
+      REQUIRE_NOTHROW(fapl.metadata_cache_config(config));
+      THEN("the values are stored in the list") {
+        auto stored = fapl.metadata_cache_config();
+        REQUIRE(stored.initial_size() == 8u * 1024u * 1024u);
+        REQUIRE(stored.min_size() == 1024u * 1024u);
+        REQUIRE(stored.max_size() == 32u * 1024u * 1024u);
+        REQUIRE(stored.min_clean_fraction() == Approx(0.5));
+        REQUIRE_FALSE(stored.adaptive());
+      }
+      AND_WHEN("disabling evictions") {
+        config.evictions_enabled(false);
+        REQUIRE_NOTHROW(fapl.metadata_cache_config(config));
+        REQUIRE_FALSE(fapl.metadata_cache_config().evictions_enabled());
+      }
+    }
+    WHEN("setting an inconsistent configuration") {
+      config.min_size(64 * 1024 * 1024);
+      config.max_size(1024 * 1024);
+      THEN("the operation fails") {
+        REQUIRE_THROWS_AS(fapl.metadata_cache_config(config), std::runtime_error);
+      }
+    }
+  }
+}
+
+SCENARIO("tuning buffers and allocation on a file access property list") {
+  GIVEN("a default constructed list") {
+    pl::FileAccessList fapl;
+    THEN("the parameters can be set") {
+      fapl.meta_block_size(128 * 1024);
+      REQUIRE(fapl.meta_block_size() == 128u * 1024u);
+      fapl.sieve_buffer_size(1024 * 1024);
+      REQUIRE(fapl.sieve_buffer_size() == 1024u * 1024u);
+      fapl.alignment(512 * 1024, 4096);
+      REQUIRE(fapl.alignment() == 4096u);
+      REQUIRE(fapl.alignment_threshold() == 512u * 1024u);
+#if H5_VERSION_GE(1,10,1)
+      fapl.page_buffer_size(4 * 4096, 20, 30);
+      REQUIRE(fapl.page_buffer_size() == 4u * 4096u);
+      REQUIRE(fapl.page_buffer_min_meta_percent() == 20u);
+      REQUIRE(fapl.page_buffer_min_raw_percent() == 30u);
+      REQUIRE_FALSE(fapl.evict_on_close());
+      fapl.evict_on_close(true);
+      REQUIRE(fapl.evict_on_close());
+#endif
+    }
+    THEN("a zero alignment is rejected") {
+      REQUIRE_THROWS_AS(fapl.alignment(1, 0), std::runtime_error);
+    }
+#if H5_VERSION_GE(1,10,1)
+    THEN("page buffer shares above 100 percent are rejected") {
+      REQUIRE_THROWS_AS(fapl.page_buffer_size(4096, 80, 40), std::runtime_error);
+    }
+#endif
+    WHEN("closing the list") {
+      close(fapl);
+      THEN("all methods throw exceptions") {
+        REQUIRE_THROWS_AS(fapl.metadata_cache_config(), std::runtime_error);
+        REQUIRE_THROWS_AS(fapl.meta_block_size(), std::runtime_error);
+        REQUIRE_THROWS_AS(fapl.sieve_buffer_size(), std::runtime_error);
+        REQUIRE_THROWS_AS(fapl.alignment(), std::runtime_error);
+        REQUIRE_THROWS_AS(fapl.profile(pl::AccessProfile::ManySmallObjects),
+                          std::runtime_error);
+      }
+    }
+  }
+}
+
+SCENARIO("applying access profiles to a file access property list") {
+  GIVEN("a default constructed list") {
+    pl::FileAccessList fapl;
+    WHEN("applying the profile for many small objects") {
+      fapl.profile(pl::AccessProfile::ManySmallObjects);
+      THEN("the metadata cache is enlarged") {
+        auto config = fapl.metadata_cache_config();
+        REQUIRE(config.initial_size() == 16u * 1024u * 1024u);
+        REQUIRE(config.max_size() == 64u * 1024u * 1024u);
+        REQUIRE(fapl.meta_block_size() == 64u * 1024u);
+        REQUIRE(fapl.sieve_buffer_size() == 64u * 1024u);
+      }
+    }
+    WHEN("applying the profile for large sequential datasets") {
+      fapl.profile(pl::AccessProfile::LargeSequentialDatasets);
+      THEN("the raw data access is tuned") {
+        REQUIRE(fapl.sieve_buffer_size() == 4u * 1024u * 1024u);
+        REQUIRE(fapl.alignment() == 4096u);
+        REQUIRE(fapl.alignment_threshold() == 1024u * 1024u);
+#if H5_VERSION_GE(1,10,1)
+        REQUIRE(fapl.evict_on_close());
+#endif
+      }
+    }
+  }
+  GIVEN("the profiles") {
+    using r = std::tuple<pl::AccessProfile, std::string>;
+    auto profiles = GENERATE(table<pl::AccessProfile, std::string>(
+        {r{pl::AccessProfile::ManySmallObjects, "MANY_SMALL_OBJECTS"},
+         r{pl::AccessProfile::LargeSequentialDatasets, "LARGE_SEQUENTIAL_DATASETS"}}));
+    THEN("they can be written to a stream") {
+      std::stringstream s;
+      s << std::get<0>(profiles);
+      REQUIRE(s.str() == std::get<1>(profiles));
+    }
+  }
+}